@@ -0,0 +1,323 @@
+#include "Demanda.hpp"
+#include "Escalonador.hpp"
+#include "Frota.hpp"
+#include "EscalonadorConcorrente.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdlib>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @file Benchmarks.cpp
+ * @brief Medições de desempenho dos TADs do simulador
+ * 
+ * Uso: bench.out [caso] [parâmetros...]
+ *   frota [numVeiculos] [numCorridas]   Despacho pelo veículo livre mais próximo,
+ *                                       com carga 0.8 e frota saturada (1.5)
+ *   escalonador [numEventos] [tamLote]  Operações em lote vs. chamadas por evento
+ *   concorrente [numEventos] [maxThreads] Contenção com 1 a maxThreads produtores
+ * Sem argumentos, executa todos os casos com tamanhos padrão.
+ */
+
+using namespace std;
+using namespace std::chrono;
+
+/**
+ * @brief Gerador pseudoaleatório determinístico (xorshift)
+ */
+struct Aleatorio {
+    unsigned long long estado;
+
+    explicit Aleatorio(unsigned long long semente) : estado(semente) {}
+
+    unsigned long long proximo() {
+        estado ^= estado << 13;
+        estado ^= estado >> 7;
+        estado ^= estado << 17;
+        return estado;
+    }
+
+    double uniforme(double min, double max) {
+        return min + (max - min) * ((proximo() >> 11) * (1.0 / 9007199254740992.0));
+    }
+};
+
+/**
+ * @brief Lê parâmetro inteiro opcional
+ */
+long long parametro(int argc, char* argv[], int indice, long long padrao) {
+    return (indice < argc) ? atoll(argv[indice]) : padrao;
+}
+
+/**
+ * @brief Despacho de corridas por uma frota finita em área 1000 x 1000
+ *
+ * Cada corrida chega em média a cada 1/taxa unidades de tempo e ocupa o
+ * veículo por uma duração aleatória. Com carga abaixo de 1 o índice espacial
+ * contém muitos veículos livres; acima de 1 a frota fica saturada e quase
+ * todo despacho espera a liberação de poucos veículos.
+ *
+ * @param carga Fração da frota que a taxa de chegada manteria ocupada
+ */
+void benchFrota(int numVeiculos, long long numCorridas, double carga) {
+    Coordenada minimo = {0.0, 0.0};
+    Coordenada maximo = {1000.0, 1000.0};
+    Aleatorio aleatorio(42);
+
+    // Cada corrida tem id único, como em simular()
+    Frota frota(numVeiculos, (int)numCorridas, minimo, maximo);
+    for (int v = 0; v < numVeiculos; v++) {
+        Coordenada pos = {aleatorio.uniforme(0.0, 1000.0), aleatorio.uniforme(0.0, 1000.0)};
+        frota.posicionarVeiculo(v, pos);
+    }
+
+    double duracaoMedia = 100.0;
+    double intervalo = duracaoMedia / (carga * numVeiculos);
+    double tempo = 0.0;
+    long long esperas = 0;
+    double latenciaDespacho = 0.0;
+    double latenciaMaxima = 0.0;
+
+    steady_clock::time_point inicio = steady_clock::now();
+
+    for (long long c = 0; c < numCorridas; c++) {
+        tempo += aleatorio.uniforme(0.0, 2.0 * intervalo);
+        Coordenada coleta = {aleatorio.uniforme(0.0, 1000.0), aleatorio.uniforme(0.0, 1000.0)};
+        Coordenada entrega = {aleatorio.uniforme(0.0, 1000.0), aleatorio.uniforme(0.0, 1000.0)};
+
+        steady_clock::time_point inicioDespacho = steady_clock::now();
+        frota.liberarAte(tempo);
+        if (frota.getNumLivres() == 0) {
+            frota.liberarProximo();
+            esperas++;
+        }
+        int veiculo = frota.despacharMaisProximo(coleta);
+        double latencia = duration<double>(steady_clock::now() - inicioDespacho).count();
+        latenciaDespacho += latencia;
+        if (latencia > latenciaMaxima) latenciaMaxima = latencia;
+
+        Evento entregaFinal = {tempo + aleatorio.uniforme(0.0, 2.0 * duracaoMedia),
+                               ENTREGA, (int)c, 0, 0};
+        frota.ocuparVeiculo(veiculo, entregaFinal, entrega);
+    }
+
+    double total = duration<double>(steady_clock::now() - inicio).count();
+
+    cout << "frota: " << numVeiculos << " veiculos, " << numCorridas << " corridas, carga "
+         << carga << ", " << esperas << " esperas" << endl;
+    cout << "  total " << total << " s, " << (numCorridas / total) << " despachos/s, "
+         << "latencia de despacho media " << (latenciaDespacho * 1e9 / numCorridas) << " ns, "
+         << "maxima " << (latenciaMaxima * 1e9) << " ns" << endl;
+}
+
+/**
+ * @brief Compara inserção/remoção evento a evento com as operações em lote
+ *
+ * Usa tempos quase ordenados, como os gerados pela Fase 1, e tempos
+ * aleatórios, pior caso para as inserções individuais.
+ */
+void benchEscalonador(int numEventos, int tamanhoLote) {
+    Evento* eventos = new Evento[numEventos];
+    Evento* buffer = new Evento[tamanhoLote];
+
+    for (int ordenado = 1; ordenado >= 0; ordenado--) {
+        Aleatorio aleatorio(7);
+        double tempo = 0.0;
+        for (int i = 0; i < numEventos; i++) {
+            tempo += aleatorio.uniforme(0.0, 1.0);
+            double t = ordenado ? tempo + aleatorio.uniforme(0.0, 10.0)
+                                : aleatorio.uniforme(0.0, (double)numEventos);
+            Evento evento = {t, (i % 2) ? ENTREGA : COLETA, i / 2, i / 2, 0};
+            eventos[i] = evento;
+        }
+
+        // Evento a evento, capacidade inicial padrão
+        int contagem = 0;
+        bool ordemCorreta = true;
+        steady_clock::time_point inicio = steady_clock::now();
+        Escalonador individual;
+        for (int i = 0; i < numEventos; i++) {
+            individual.insereEvento(eventos[i]);
+        }
+        double insercao = duration<double>(steady_clock::now() - inicio).count();
+        inicio = steady_clock::now();
+        while (!individual.vazio()) {
+            individual.retiraProximoEvento();
+            contagem++;
+        }
+        double remocao = duration<double>(steady_clock::now() - inicio).count();
+
+        // Em lote: reserva + construção de baixo para cima + remoção por tempo
+        inicio = steady_clock::now();
+        Escalonador lote;
+        lote.reservar(numEventos);
+        lote.insereEventos(eventos, numEventos);
+        double insercaoLote = duration<double>(steady_clock::now() - inicio).count();
+        inicio = steady_clock::now();
+        int retirados;
+        double ultimo = 0.0;
+        while ((retirados = lote.retiraEventosAte(numEventos * 2.0, buffer, tamanhoLote)) > 0) {
+            for (int i = 0; i < retirados; i++) {
+                if (buffer[i].tempo < ultimo) ordemCorreta = false;
+                ultimo = buffer[i].tempo;
+                contagem--;
+            }
+        }
+        double remocaoLote = duration<double>(steady_clock::now() - inicio).count();
+
+        cout << "escalonador (" << (ordenado ? "quase ordenado" : "aleatorio") << "): "
+             << numEventos << " eventos, lote " << tamanhoLote
+             << ((contagem == 0 && ordemCorreta) ? "" : " [ORDEM DIVERGENTE]") << endl;
+        cout << "  insercao: individual " << insercao * 1e3 << " ms, lote "
+             << insercaoLote * 1e3 << " ms" << endl;
+        cout << "  remocao:  individual " << remocao * 1e3 << " ms, lote "
+             << remocaoLote * 1e3 << " ms" << endl;
+    }
+
+    delete[] eventos;
+    delete[] buffer;
+}
+
+/**
+ * @brief Gera os eventos de um produtor, com tempos aleatórios
+ */
+void gerarEventosProdutor(int idProdutor, int numEventos, Evento* eventos) {
+    Aleatorio aleatorio(1000 + idProdutor);
+    for (int i = 0; i < numEventos; i++) {
+        Evento evento = {aleatorio.uniforme(0.0, 1e6), COLETA, idProdutor, i, 0};
+        eventos[i] = evento;
+    }
+}
+
+/**
+ * @brief Executa produtores em paralelo e retorna o tempo de parede
+ * @param produzir Função chamada por cada thread com seu índice
+ */
+template <typename Funcao>
+double executarProdutores(int numThreads, Funcao produzir) {
+    steady_clock::time_point inicio = steady_clock::now();
+
+    vector<thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.push_back(thread(produzir, t));
+    }
+    for (int t = 0; t < numThreads; t++) {
+        threads[t].join();
+    }
+
+    return duration<double>(steady_clock::now() - inicio).count();
+}
+
+/**
+ * @brief Contenção na inserção com vários produtores
+ *
+ * Compara um Escalonador único protegido por mutex com o
+ * EscalonadorConcorrente com uma partição (só buffers por produtor) e com
+ * uma partição por produtor. O total de eventos é fixo e dividido entre
+ * as threads; o consumidor único verifica a ordem ao final.
+ */
+void benchConcorrente(int numEventos, int maxThreads) {
+    cout << "concorrente: " << numEventos << " eventos (tempos de insercao em ms)" << endl;
+    cout << "  threads   mutex global   buffers/1 particao   buffers/p particoes   consumo" << endl;
+
+    for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+        int porThread = numEventos / numThreads;
+        vector<Evento*> eventos(numThreads);
+        for (int t = 0; t < numThreads; t++) {
+            eventos[t] = new Evento[porThread];
+            gerarEventosProdutor(t, porThread, eventos[t]);
+        }
+
+        // Escalonador único com mutex global
+        Escalonador global;
+        mutex travaGlobal;
+        double tempoGlobal = executarProdutores(numThreads, [&](int t) {
+            for (int i = 0; i < porThread; i++) {
+                lock_guard<mutex> guarda(travaGlobal);
+                global.insereEvento(eventos[t][i]);
+            }
+        });
+
+        // Buffers por produtor, todos descarregando na mesma partição
+        EscalonadorConcorrente umaParticao(numThreads, 1);
+        double tempoUmaParticao = executarProdutores(numThreads, [&](int t) {
+            for (int i = 0; i < porThread; i++) {
+                umaParticao.insereEvento(t, eventos[t][i]);
+            }
+            umaParticao.descarregar(t);
+        });
+
+        // Buffers por produtor e uma partição por produtor
+        EscalonadorConcorrente particionado(numThreads);
+        double tempoParticionado = executarProdutores(numThreads, [&](int t) {
+            for (int i = 0; i < porThread; i++) {
+                particionado.insereEvento(t, eventos[t][i]);
+            }
+            particionado.descarregar(t);
+        });
+
+        // Consumidor único: ordem exata de tempo
+        steady_clock::time_point inicio = steady_clock::now();
+        int consumidos = 0;
+        bool ordemCorreta = true;
+        double ultimo = 0.0;
+        while (!particionado.vazio()) {
+            Evento evento = particionado.retiraProximoEvento();
+            if (evento.tempo < ultimo) ordemCorreta = false;
+            ultimo = evento.tempo;
+            consumidos++;
+        }
+        double tempoConsumo = duration<double>(steady_clock::now() - inicio).count();
+
+        cout << "  " << setw(7) << numThreads
+             << setw(15) << tempoGlobal * 1e3
+             << setw(21) << tempoUmaParticao * 1e3
+             << setw(22) << tempoParticionado * 1e3
+             << setw(10) << tempoConsumo * 1e3
+             << ((ordemCorreta && consumidos == porThread * numThreads) ? "" : " [ORDEM DIVERGENTE]")
+             << endl;
+
+        for (int t = 0; t < numThreads; t++) {
+            delete[] eventos[t];
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    cout << fixed << setprecision(2);
+
+    const char* caso = (argc > 1) ? argv[1] : "todos";
+    bool todos = (strcmp(caso, "todos") == 0);
+    bool executou = false;
+
+    if (todos || strcmp(caso, "frota") == 0) {
+        int numVeiculos = (int)parametro(argc, argv, 2, 100000);
+        long long numCorridas = parametro(argc, argv, 3, 1000000);
+        benchFrota(numVeiculos, numCorridas, 0.8);
+        benchFrota(numVeiculos, numCorridas, 1.5);
+        executou = true;
+    }
+
+    if (todos || strcmp(caso, "escalonador") == 0) {
+        benchEscalonador((int)parametro(argc, argv, 2, 2000000),
+                         (int)parametro(argc, argv, 3, 1024));
+        executou = true;
+    }
+
+    if (todos || strcmp(caso, "concorrente") == 0) {
+        benchConcorrente((int)parametro(argc, argv, 2, 2000000),
+                         (int)parametro(argc, argv, 3, 32));
+        executou = true;
+    }
+
+    if (!executou) {
+        cerr << "Caso desconhecido: " << caso << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -22,6 +22,11 @@ struct InfoCorrida {
     InfoCorrida();
     ~InfoCorrida();
 
+    /**
+     * @brief Esvazia a corrida para reuso, mantendo o buffer de IDs
+     */
+    void limpar();
+
     /**
      * @brief Adiciona demanda à corrida
      * @param idDemanda ID da demanda
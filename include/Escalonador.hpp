@@ -1,12 +1,16 @@
 #ifndef ESCALONADOR_HPP
 #define ESCALONADOR_HPP
 
+#include "Memoria.hpp"
+
 /**
  * @file Escalonador.hpp
  * @brief TAD Escalonador - Fila de prioridade para simulação de eventos discretos
  * 
  * Implementado como MinHeap baseado em tempo
  * Complexidade: O(log n) para inserção e remoção
+ * Operações em lote: carga de k eventos em O(n + k) e remoção de todos
+ * os eventos até um tempo para um buffer do chamador
  */
 
 enum TipoEvento {
@@ -27,6 +31,7 @@ private:
     Evento* heap;           // Array para armazenar eventos
     int capacidade;         // Capacidade máxima do heap
     int tamanho;            // Número atual de elementos
+    Subsistema subsistema;  // Subsistema em que o heap é contabilizado
 
     /**
      * @brief Retorna índice do pai
@@ -76,13 +81,20 @@ private:
      */
     void redimensionar();
 
+    /**
+     * @brief Restaura a propriedade do heap de baixo para cima (Floyd)
+     * Complexidade: O(n)
+     */
+    void construirHeap();
+
 public:
     /**
      * @brief Construtor - inicializa heap vazio
      * @param capacidadeInicial Capacidade inicial do heap (padrão: 100)
+     * @param subsistema Subsistema em que o heap é contabilizado
      * Complexidade: O(1)
      */
-    Escalonador(int capacidadeInicial = 100);
+    Escalonador(int capacidadeInicial = 100, Subsistema subsistema = MEM_ESCALONADOR);
 
     /**
      * @brief Destrutor - libera memória alocada
@@ -97,6 +109,42 @@ public:
      */
     void insereEvento(const Evento& evento);
 
+    /**
+     * @brief Garante capacidade para pelo menos o número de eventos dado
+     * @param capacidadeMinima Número de eventos que devem caber sem redimensionar
+     * Complexidade: O(n) se precisar realocar, O(1) caso contrário
+     */
+    void reservar(int capacidadeMinima);
+
+    /**
+     * @brief Insere um lote de eventos
+     * @param eventos Array de eventos a inserir
+     * @param numEventos Número de eventos do lote
+     * Usa inserções individuais quando k log2(n + k) < n + k; caso contrário
+     * anexa o lote e reconstrói o heap de baixo para cima.
+     * Complexidade: O(min(k log(n + k), n + k)) para k eventos
+     */
+    void insereEventos(const Evento* eventos, int numEventos);
+
+    /**
+     * @brief Remove, em ordem de tempo, os eventos com tempo até o limite
+     * @param tempoLimite Tempo máximo (inclusivo) dos eventos removidos
+     * @param buffer Array do chamador que recebe os eventos
+     * @param maxEventos Capacidade do buffer
+     * @return Número de eventos copiados para o buffer
+     * Complexidade: O(k log n) para k eventos removidos
+     */
+    int retiraEventosAte(double tempoLimite, Evento* buffer, int maxEventos);
+
+    /**
+     * @brief Remove, em ordem de tempo, até maxEventos eventos
+     * @param buffer Array do chamador que recebe os eventos
+     * @param maxEventos Capacidade do buffer
+     * @return Número de eventos copiados (0 somente se o escalonador estiver vazio)
+     * Complexidade: O(k log n) para k eventos removidos
+     */
+    int retiraEventos(Evento* buffer, int maxEventos);
+
     /**
      * @brief Remove e retorna o próximo evento (menor tempo)
      * @return Evento com menor tempo
@@ -104,6 +152,12 @@ public:
      */
     Evento retiraProximoEvento();
 
+    /**
+     * @brief Remove todos os eventos, mantendo a capacidade alocada
+     * Complexidade: O(1)
+     */
+    void limpar();
+
     /**
      * @brief Verifica se o escalonador está vazio
      * @return true se vazio, false caso contrário
@@ -0,0 +1,102 @@
+#ifndef ESCALONADOR_CONCORRENTE_HPP
+#define ESCALONADOR_CONCORRENTE_HPP
+
+#include "Escalonador.hpp"
+#include <mutex>
+
+/**
+ * @file EscalonadorConcorrente.hpp
+ * @brief TAD EscalonadorConcorrente - Fila de prioridade com vários produtores
+ * 
+ * Cada produtor acumula eventos em um buffer próprio, sem sincronização,
+ * e o descarrega em lote em uma das partições (um Escalonador protegido
+ * por mutex). Se a partição preferida estiver ocupada, tenta as seguintes
+ * antes de bloquear. Depois que todos os produtores descarregam seus
+ * buffers, um único consumidor retira os eventos em ordem exata de tempo,
+ * intercalando as partições.
+ */
+
+class EscalonadorConcorrente {
+private:
+    struct Particao {
+        Escalonador heap;            // Eventos desta partição
+        std::mutex trava;            // Protege heap durante a produção
+        char preenchimento[64];      // Evita falso compartilhamento entre partições
+    };
+
+    struct BufferProdutor {
+        Evento* eventos;             // Eventos ainda não descarregados
+        int tamanho;                 // Número de eventos no buffer
+        char preenchimento[64];      // Evita falso compartilhamento entre produtores
+    };
+
+    Particao* particoes;             // Array de partições
+    int numParticoes;                // Número de partições
+    BufferProdutor* buffers;         // Um buffer por produtor
+    int numProdutores;               // Número de produtores
+    int capacidadeBuffer;            // Eventos por buffer antes do descarregamento
+
+    /**
+     * @brief Retorna a partição com o evento de menor tempo
+     * @return Índice da partição, ou -1 se todas estiverem vazias
+     * Complexidade: O(p), com p partições
+     */
+    int particaoMinima() const;
+
+public:
+    /**
+     * @brief Construtor
+     * @param numProdutores Número de threads produtoras
+     * @param numParticoes Número de partições (padrão: uma por produtor)
+     * @param capacidadeBuffer Eventos acumulados por produtor antes de descarregar
+     * Complexidade: O(numProdutores * capacidadeBuffer)
+     */
+    EscalonadorConcorrente(int numProdutores, int numParticoes = 0,
+                           int capacidadeBuffer = 256);
+
+    /**
+     * @brief Destrutor - libera memória alocada
+     */
+    ~EscalonadorConcorrente();
+
+    /**
+     * @brief Insere evento pelo buffer do produtor
+     * @param idProdutor Índice do produtor (cada thread usa o seu)
+     * @param evento Evento a ser inserido
+     * Pode ser chamado simultaneamente por produtores distintos.
+     * Complexidade: O(1) amortizado fora do descarregamento
+     */
+    void insereEvento(int idProdutor, const Evento& evento);
+
+    /**
+     * @brief Descarrega o buffer do produtor em uma partição
+     * @param idProdutor Índice do produtor
+     * Deve ser chamado por cada produtor ao terminar.
+     * Complexidade: O(k log n) para k eventos no buffer
+     */
+    void descarregar(int idProdutor);
+
+    /**
+     * @brief Remove e retorna o evento de menor tempo entre as partições
+     * @return Evento com menor tempo
+     * Só pode ser chamado depois que todos os produtores descarregaram.
+     * Complexidade: O(p + log n)
+     */
+    Evento retiraProximoEvento();
+
+    /**
+     * @brief Verifica se todas as partições estão vazias
+     * @return true se vazio
+     * Complexidade: O(p)
+     */
+    bool vazio() const;
+
+    /**
+     * @brief Retorna o número de eventos nas partições
+     * @return Número de eventos (não inclui buffers não descarregados)
+     * Complexidade: O(p)
+     */
+    int getTamanho() const;
+};
+
+#endif // ESCALONADOR_CONCORRENTE_HPP
@@ -0,0 +1,171 @@
+#ifndef FROTA_HPP
+#define FROTA_HPP
+
+#include "Demanda.hpp"
+#include "Escalonador.hpp"
+
+/**
+ * @file Frota.hpp
+ * @brief TAD Frota - Conjunto finito de veículos e despacho por proximidade
+ * 
+ * Mantém posição e disponibilidade de cada veículo. Os veículos livres
+ * ficam em um índice espacial (grade uniforme com listas encadeadas por
+ * célula, agrupadas em blocos com contagem de livres) e em um conjunto
+ * denso; os ocupados são liberados pelos eventos de ENTREGA final de suas
+ * corridas, mantidos em um Escalonador próprio.
+ */
+
+struct Veiculo {
+    Coordenada posicao;      // Posição atual (ou final da corrida em curso)
+    double tempoDisponivel;  // Momento a partir do qual está livre
+    bool livre;              // Se está no índice de veículos livres
+};
+
+class Frota {
+private:
+    Veiculo* veiculos;       // Array de veículos
+    int numVeiculos;         // Número de veículos
+    int numLivres;           // Número de veículos livres
+
+    // Índice espacial: grade uniforme sobre a área das demandas
+    double xMin, yMin;       // Canto inferior esquerdo da grade
+    double tamCelula;        // Lado de cada célula
+    int colunas, linhas;     // Dimensões da grade
+    int* primeiroDaCelula;   // Primeiro veículo livre de cada célula (-1 se vazia)
+    int* proximo;            // Próximo veículo livre na mesma célula
+    int* anterior;           // Veículo livre anterior na mesma célula
+    int* celulaDoVeiculo;    // Célula em que o veículo está indexado
+
+    // Nível grosso do índice: blocos de LADO_BLOCO x LADO_BLOCO células
+    int blocoColunas, blocoLinhas; // Dimensões da grade de blocos
+    int* livresDoBloco;      // Veículos livres em cada bloco
+
+    // Conjunto denso de veículos livres, para frotas quase saturadas
+    int* livres;             // Índices dos veículos livres (numLivres primeiros)
+    int* posicaoLivre;       // Posição de cada veículo livre em livres
+
+    // Liberação dos veículos ocupados
+    Escalonador liberacoes;  // Eventos de ENTREGA final das corridas em curso
+    int* veiculoDaCorrida;   // Veículo que atende cada corrida
+    int maxCorridas;         // Tamanho de veiculoDaCorrida
+
+    /**
+     * @brief Retorna a célula que contém a coordenada (limitada à grade)
+     * @param coord Coordenada
+     * @param coluna Recebe a coluna da célula
+     * @param linha Recebe a linha da célula
+     */
+    void localizarCelula(const Coordenada& coord, int& coluna, int& linha) const;
+
+    /**
+     * @brief Retorna o bloco que contém a célula
+     * @param celula Índice da célula
+     */
+    int blocoDaCelula(int celula) const;
+
+    /**
+     * @brief Compara veículo com o melhor candidato até agora
+     * @param v Índice do veículo
+     * @param pos Coordenada de coleta
+     * @param melhor Melhor veículo (-1 se nenhum); atualizado
+     * @param melhorDist Distância do melhor veículo; atualizada
+     * Empates ficam com o menor índice, independentemente da ordem de visita.
+     */
+    void compararCandidato(int v, const Coordenada& pos, int& melhor, double& melhorDist) const;
+
+    /**
+     * @brief Busca o veículo livre mais próximo em anéis ao redor da coleta
+     * @tparam LADO Lado, em células, de cada unidade do anel (1 ou LADO_BLOCO)
+     * @param pos Coordenada de coleta
+     * @param melhor Melhor veículo (-1 se nenhum); atualizado
+     * @param melhorDist Distância do melhor veículo; atualizada
+     * Com LADO_BLOCO, blocos sem veículos livres não são visitados.
+     */
+    template <int LADO>
+    void buscarEmAneis(const Coordenada& pos, int& melhor, double& melhorDist) const;
+
+    /**
+     * @brief Insere veículo na lista de sua célula
+     * @param v Índice do veículo
+     * Complexidade: O(1)
+     */
+    void insereNoIndice(int v);
+
+    /**
+     * @brief Remove veículo da lista de sua célula
+     * @param v Índice do veículo
+     * Complexidade: O(1)
+     */
+    void removeDoIndice(int v);
+
+    /**
+     * @brief Libera o veículo da corrida associada a um evento de entrega
+     * @param evento Evento de ENTREGA final
+     */
+    void liberar(const Evento& evento);
+
+public:
+    /**
+     * @brief Construtor - cria veículos livres na origem da grade
+     * @param numVeiculos Número de veículos da frota
+     * @param maxCorridas Número máximo de corridas a despachar
+     * @param minimo Canto inferior esquerdo da área atendida
+     * @param maximo Canto superior direito da área atendida
+     * Complexidade: O(numVeiculos + maxCorridas)
+     */
+    Frota(int numVeiculos, int maxCorridas, Coordenada minimo, Coordenada maximo);
+
+    /**
+     * @brief Destrutor - libera memória alocada
+     */
+    ~Frota();
+
+    /**
+     * @brief Reposiciona um veículo livre
+     * @param v Índice do veículo
+     * @param pos Nova posição
+     * Complexidade: O(1)
+     */
+    void posicionarVeiculo(int v, const Coordenada& pos);
+
+    /**
+     * @brief Retira do índice o veículo livre mais próximo da coordenada
+     * @param pos Coordenada de coleta
+     * @return Índice do veículo, ou -1 se não houver veículo livre
+     * Com poucos livres (numLivres^2 <= células) percorre o conjunto denso;
+     * com menos de um livre por bloco percorre anéis de blocos, pulando os
+     * vazios; com mais, anéis de células.
+     * Complexidade: O(min(numLivres, unidades visitadas nos anéis))
+     */
+    int despacharMaisProximo(const Coordenada& pos);
+
+    /**
+     * @brief Marca veículo como ocupado até a entrega final de sua corrida
+     * @param v Índice do veículo despachado
+     * @param entregaFinal Evento de ENTREGA que encerra a corrida
+     * @param posFinal Coordenada da entrega final
+     * Lança std::logic_error se a corrida ainda tiver liberação pendente.
+     * Complexidade: O(log n)
+     */
+    void ocuparVeiculo(int v, const Evento& entregaFinal, const Coordenada& posFinal);
+
+    /**
+     * @brief Libera todos os veículos com entrega final até o tempo dado
+     * @param tempo Tempo atual da simulação
+     * Complexidade: O(m log n), com m veículos liberados
+     */
+    void liberarAte(double tempo);
+
+    /**
+     * @brief Libera os veículos da próxima entrega final pendente
+     * @return Tempo em que os veículos foram liberados
+     * Complexidade: O(log n)
+     */
+    double liberarProximo();
+
+    int getNumVeiculos() const;
+    int getNumLivres() const;
+    const Veiculo& getVeiculo(int v) const;
+};
+
+#endif // FROTA_HPP
@@ -0,0 +1,108 @@
+#ifndef MEMORIA_HPP
+#define MEMORIA_HPP
+
+#include <cstddef>
+#include <new>
+
+/**
+ * @file Memoria.hpp
+ * @brief Alocação de arrays com contabilidade por subsistema
+ * 
+ * Substitui new[]/delete[] nos TADs do simulador. Cada alocação guarda um
+ * pequeno cabeçalho com seu tamanho e subsistema, e os contadores (bytes
+ * vivos, pico de bytes e número de alocações) são atômicos, podendo ser
+ * lidos a qualquer momento, inclusive de um tratador de sinal.
+ */
+
+enum Subsistema {
+    MEM_DEMANDAS,       // Array de demandas e estado por demanda
+    MEM_CORRIDAS,       // Tabela de corridas e buffers de InfoCorrida
+    MEM_ESCALONADOR,    // Heaps e buffers de eventos
+    MEM_PARADAS,        // Paradas registradas por corrida
+    MEM_FROTA,          // Veículos, índice espacial e liberações
+    NUM_SUBSISTEMAS
+};
+
+/**
+ * @brief Registra alocação de bytes em um subsistema
+ * @param subsistema Subsistema responsável
+ * @param bytes Número de bytes alocados
+ * Complexidade: O(1)
+ */
+void registrarAlocacao(Subsistema subsistema, std::size_t bytes);
+
+/**
+ * @brief Registra liberação de bytes de um subsistema
+ * @param subsistema Subsistema responsável
+ * @param bytes Número de bytes liberados
+ * Complexidade: O(1)
+ */
+void registrarLiberacao(Subsistema subsistema, std::size_t bytes);
+
+/**
+ * @brief Escreve o resumo por subsistema no descritor de arquivo
+ * @param fd Descritor de arquivo (ex.: 2 para stderr)
+ * Usa apenas write(), podendo ser chamada de um tratador de sinal.
+ */
+void imprimirRelatorioMemoria(int fd);
+
+/**
+ * @brief Imprime o resumo em stderr ao sair do processo e ao receber SIGUSR1
+ */
+void instalarRelatorioMemoria();
+
+// Cabeçalho de cada alocação, alinhado para qualquer tipo fundamental
+union CabecalhoMemoria {
+    struct {
+        std::size_t numElementos;
+        std::size_t bytes;
+        Subsistema subsistema;
+    } info;
+    long double alinhamento;
+    void* alinhamentoPonteiro;
+};
+
+/**
+ * @brief Aloca e constrói um array contabilizado no subsistema
+ * @param numElementos Número de elementos
+ * @param subsistema Subsistema responsável
+ * @return Ponteiro para o primeiro elemento
+ * Complexidade: O(n) para tipos com construtor, O(1) caso contrário
+ */
+template <typename T>
+T* alocarArray(std::size_t numElementos, Subsistema subsistema) {
+    std::size_t bytes = sizeof(CabecalhoMemoria) + numElementos * sizeof(T);
+    CabecalhoMemoria* cabecalho = static_cast<CabecalhoMemoria*>(::operator new(bytes));
+    cabecalho->info.numElementos = numElementos;
+    cabecalho->info.bytes = bytes;
+    cabecalho->info.subsistema = subsistema;
+    registrarAlocacao(subsistema, bytes);
+
+    T* elementos = reinterpret_cast<T*>(cabecalho + 1);
+    for (std::size_t i = 0; i < numElementos; i++) {
+        new (elementos + i) T;
+    }
+    return elementos;
+}
+
+/**
+ * @brief Destrói e libera um array obtido com alocarArray
+ * @param elementos Ponteiro retornado por alocarArray (pode ser nulo)
+ * Complexidade: O(n) para tipos com destrutor, O(1) caso contrário
+ */
+template <typename T>
+void liberarArray(T* elementos) {
+    if (elementos == nullptr) {
+        return;
+    }
+
+    CabecalhoMemoria* cabecalho = reinterpret_cast<CabecalhoMemoria*>(elementos) - 1;
+    for (std::size_t i = cabecalho->info.numElementos; i > 0; i--) {
+        elementos[i - 1].~T();
+    }
+
+    registrarLiberacao(cabecalho->info.subsistema, cabecalho->info.bytes);
+    ::operator delete(cabecalho);
+}
+
+#endif // MEMORIA_HPP
@@ -0,0 +1,84 @@
+#ifndef SIMULACAO_HPP
+#define SIMULACAO_HPP
+
+#include "Demanda.hpp"
+#include "Corrida.hpp"
+#include "Escalonador.hpp"
+#include <iosfwd>
+
+/**
+ * @file Simulacao.hpp
+ * @brief Simulação de um dia de demandas: combinação de corridas (Fase 1)
+ * e processamento dos eventos em ordem de tempo (Fase 2)
+ */
+
+/**
+ * @brief Armazenamento reaproveitado entre simulações
+ *
+ * Os arrays só crescem, de modo que uma thread do modo em lote processa
+ * vários arquivos sem realocar demandas, corridas, eventos e paradas.
+ */
+struct ContextoSimulacao {
+    int capacidade;            // Demandas suportadas sem realocar
+    int capacidadeGrupo;       // Passageiros suportados por grupo
+
+    Demanda* demandas;         // Demandas lidas
+    int* proximoLivre;         // Lista de demandas não atribuídas: próxima
+    int* anteriorLivre;        // Lista de demandas não atribuídas: anterior
+    InfoCorrida* corridas;     // No máximo uma corrida por demanda
+    int* grupo;                // Grupo em formação na Fase 1
+    Evento* eventos;           // Eventos da Fase 1 e lotes da Fase 2
+    Escalonador escalonador;   // Heap de eventos
+
+    double* tempoConclusao;    // Tempo do último evento de cada corrida
+    int* paradasPorCorrida;    // Paradas registradas por corrida
+    bool* corridaConcluida;    // Se a última entrega já ocorreu
+    int* inicioParadas;        // Posição da primeira parada de cada corrida
+    Coordenada* paradas;       // Paradas de todas as corridas, contíguas
+
+    ContextoSimulacao();
+    ~ContextoSimulacao();
+
+    /**
+     * @brief Garante espaço para numDemandas demandas e grupos de eta
+     * @param numDemandas Número de demandas da próxima simulação
+     * @param eta Capacidade dos veículos
+     */
+    void reservar(int numDemandas, int eta);
+};
+
+/**
+ * @brief Contadores de uma simulação, impressos em stderr ou no resumo do lote
+ */
+struct ResultadoSimulacao {
+    int numDemandas;
+    int numCorridas;
+
+    // Pré-filtro de eficiência
+    long long candidatosEficiencia;
+    long long avaliacoesEvitadas;
+
+    // Despacho (apenas com frota finita)
+    int numVeiculos;
+    long long corridasComEspera;
+    double distAproximacao;
+    double tempoEspera;
+    double latenciaDespacho;     // Segundos
+    double latenciaMaxima;       // Segundos
+};
+
+/**
+ * @brief Executa a simulação de um dia de demandas
+ * @param entrada Parâmetros e demandas, no formato da entrada padrão
+ * @param saida Destino das corridas concluídas
+ * @param ctx Armazenamento reaproveitado
+ * @param numVeiculos Tamanho da frota (0: um veículo surge em cada coleta)
+ * @param rastrear Se true, escreve em saida a eficiência de cada candidato
+ *        avaliado; o pré-filtro fica desligado para que todos apareçam
+ * @param resultado Recebe os contadores da simulação
+ * @return false se a entrada estiver malformada
+ */
+bool simular(std::istream& entrada, std::ostream& saida, ContextoSimulacao& ctx,
+             int numVeiculos, bool rastrear, ResultadoSimulacao& resultado);
+
+#endif // SIMULACAO_HPP
@@ -1,25 +1,33 @@
 #include "Corrida.hpp"
+#include "Memoria.hpp"
 #include <cmath>
 
 InfoCorrida::InfoCorrida() 
     : numDemandas(0), capacidade(10), distanciaTotal(0.0), 
       tempoInicio(0.0), processada(false) {
-    demandasIds = new int[capacidade];
+    demandasIds = alocarArray<int>(capacidade, MEM_CORRIDAS);
 }
 
 InfoCorrida::~InfoCorrida() {
-    delete[] demandasIds;
+    liberarArray(demandasIds);
+}
+
+void InfoCorrida::limpar() {
+    numDemandas = 0;
+    distanciaTotal = 0.0;
+    tempoInicio = 0.0;
+    processada = false;
 }
 
 void InfoCorrida::adicionarDemanda(int idDemanda) {
     if (numDemandas >= capacidade) {
         // Redimensiona se necessário
         int novaCapacidade = capacidade * 2;
-        int* novoArray = new int[novaCapacidade];
+        int* novoArray = alocarArray<int>(novaCapacidade, MEM_CORRIDAS);
         for (int i = 0; i < numDemandas; i++) {
             novoArray[i] = demandasIds[i];
         }
-        delete[] demandasIds;
+        liberarArray(demandasIds);
         demandasIds = novoArray;
         capacidade = novaCapacidade;
     }
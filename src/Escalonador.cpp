@@ -58,7 +58,7 @@ void Escalonador::redimensionar() {
     // Dobra a capacidade do heap
     // Complexidade: O(n) - copia todos elementos
     int novaCapacidade = capacidade * 2;
-    Evento* novoHeap = new Evento[novaCapacidade];
+    Evento* novoHeap = alocarArray<Evento>(novaCapacidade, subsistema);
 
     // Copia elementos existentes
     for (int i = 0; i < tamanho; i++) {
@@ -66,20 +66,28 @@ void Escalonador::redimensionar() {
     }
 
     // Libera heap antigo e atualiza
-    delete[] heap;
+    liberarArray(heap);
     heap = novoHeap;
     capacidade = novaCapacidade;
 }
 
+void Escalonador::construirHeap() {
+    // Desce cada nó interno, do último ao primeiro
+    // Complexidade: O(n) - a maioria dos nós está perto das folhas
+    for (int i = tamanho / 2 - 1; i >= 0; i--) {
+        heapifyDown(i);
+    }
+}
+
 // ==================== Métodos Públicos ====================
 
-Escalonador::Escalonador(int capacidadeInicial) 
-    : capacidade(capacidadeInicial), tamanho(0) {
-    heap = new Evento[capacidade];
+Escalonador::Escalonador(int capacidadeInicial, Subsistema subsistema) 
+    : capacidade(capacidadeInicial), tamanho(0), subsistema(subsistema) {
+    heap = alocarArray<Evento>(capacidade, subsistema);
 }
 
 Escalonador::~Escalonador() {
-    delete[] heap;
+    liberarArray(heap);
 }
 
 void Escalonador::insereEvento(const Evento& evento) {
@@ -95,6 +103,89 @@ void Escalonador::insereEvento(const Evento& evento) {
     tamanho++;
 }
 
+void Escalonador::reservar(int capacidadeMinima) {
+    // Complexidade: O(n) se realocar
+    if (capacidadeMinima <= capacidade) {
+        return;
+    }
+
+    Evento* novoHeap = alocarArray<Evento>(capacidadeMinima, subsistema);
+    for (int i = 0; i < tamanho; i++) {
+        novoHeap[i] = heap[i];
+    }
+
+    liberarArray(heap);
+    heap = novoHeap;
+    capacidade = capacidadeMinima;
+}
+
+void Escalonador::insereEventos(const Evento* eventos, int numEventos) {
+    if (numEventos <= 0) {
+        return;
+    }
+
+    // Crescimento geométrico, como em redimensionar, para lotes sucessivos
+    if (tamanho + numEventos > capacidade) {
+        int dobro = capacidade * 2;
+        reservar((tamanho + numEventos > dobro) ? tamanho + numEventos : dobro);
+    }
+
+    // Ponto de cruzamento: k inserções custam O(k log(n + k)) e a
+    // reconstrução O(n + k); insere um a um só quando isso sai mais barato
+    int total = tamanho + numEventos;
+    long long log2Total = 0;
+    for (int t = total; t > 1; t >>= 1) {
+        log2Total++;
+    }
+    if (static_cast<long long>(numEventos) * log2Total < total) {
+        for (int i = 0; i < numEventos; i++) {
+            heap[tamanho] = eventos[i];
+            heapifyUp(tamanho);
+            tamanho++;
+        }
+        return;
+    }
+
+    // Lote grande: anexa tudo e reconstrói em O(n + k)
+    for (int i = 0; i < numEventos; i++) {
+        heap[tamanho + i] = eventos[i];
+    }
+    tamanho += numEventos;
+    construirHeap();
+}
+
+int Escalonador::retiraEventosAte(double tempoLimite, Evento* buffer, int maxEventos) {
+    int numRetirados = 0;
+
+    while (numRetirados < maxEventos && tamanho > 0 && heap[0].tempo <= tempoLimite) {
+        buffer[numRetirados++] = heap[0];
+
+        heap[0] = heap[tamanho - 1];
+        tamanho--;
+        if (tamanho > 0) {
+            heapifyDown(0);
+        }
+    }
+
+    return numRetirados;
+}
+
+int Escalonador::retiraEventos(Evento* buffer, int maxEventos) {
+    int numRetirados = 0;
+
+    while (numRetirados < maxEventos && tamanho > 0) {
+        buffer[numRetirados++] = heap[0];
+
+        heap[0] = heap[tamanho - 1];
+        tamanho--;
+        if (tamanho > 0) {
+            heapifyDown(0);
+        }
+    }
+
+    return numRetirados;
+}
+
 Evento Escalonador::retiraProximoEvento() {
     // Complexidade: O(log n)
     if (tamanho == 0) {
@@ -116,6 +207,10 @@ Evento Escalonador::retiraProximoEvento() {
     return minimo;
 }
 
+void Escalonador::limpar() {
+    tamanho = 0;
+}
+
 bool Escalonador::vazio() const {
     return tamanho == 0;
 }
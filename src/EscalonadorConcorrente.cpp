@@ -0,0 +1,98 @@
+#include "EscalonadorConcorrente.hpp"
+#include "Memoria.hpp"
+#include <stdexcept>
+
+// ==================== Métodos Privados ====================
+
+int EscalonadorConcorrente::particaoMinima() const {
+    int menor = -1;
+    for (int p = 0; p < numParticoes; p++) {
+        if (particoes[p].heap.vazio()) continue;
+
+        if (menor == -1 ||
+            particoes[p].heap.proximoEvento().tempo < particoes[menor].heap.proximoEvento().tempo) {
+            menor = p;
+        }
+    }
+    return menor;
+}
+
+// ==================== Métodos Públicos ====================
+
+EscalonadorConcorrente::EscalonadorConcorrente(int numProdutores, int numParticoes,
+                                               int capacidadeBuffer)
+    : numParticoes(numParticoes > 0 ? numParticoes : numProdutores),
+      numProdutores(numProdutores), capacidadeBuffer(capacidadeBuffer) {
+    if (numProdutores <= 0 || capacidadeBuffer <= 0) {
+        throw std::invalid_argument("Parametros invalidos do escalonador concorrente");
+    }
+
+    particoes = alocarArray<Particao>(this->numParticoes, MEM_ESCALONADOR);
+
+    buffers = alocarArray<BufferProdutor>(numProdutores, MEM_ESCALONADOR);
+    for (int i = 0; i < numProdutores; i++) {
+        buffers[i].eventos = alocarArray<Evento>(capacidadeBuffer, MEM_ESCALONADOR);
+        buffers[i].tamanho = 0;
+    }
+}
+
+EscalonadorConcorrente::~EscalonadorConcorrente() {
+    for (int i = 0; i < numProdutores; i++) {
+        liberarArray(buffers[i].eventos);
+    }
+    liberarArray(buffers);
+    liberarArray(particoes);
+}
+
+void EscalonadorConcorrente::insereEvento(int idProdutor, const Evento& evento) {
+    BufferProdutor& buffer = buffers[idProdutor];
+    buffer.eventos[buffer.tamanho++] = evento;
+
+    if (buffer.tamanho == capacidadeBuffer) {
+        descarregar(idProdutor);
+    }
+}
+
+void EscalonadorConcorrente::descarregar(int idProdutor) {
+    BufferProdutor& buffer = buffers[idProdutor];
+    if (buffer.tamanho == 0) {
+        return;
+    }
+
+    // Tenta a partição preferida e as seguintes sem bloquear; se todas
+    // estiverem ocupadas, espera pela preferida
+    int preferida = idProdutor % numParticoes;
+    for (int tentativa = 0; tentativa < numParticoes; tentativa++) {
+        Particao& particao = particoes[(preferida + tentativa) % numParticoes];
+        if (particao.trava.try_lock()) {
+            particao.heap.insereEventos(buffer.eventos, buffer.tamanho);
+            particao.trava.unlock();
+            buffer.tamanho = 0;
+            return;
+        }
+    }
+
+    std::lock_guard<std::mutex> guarda(particoes[preferida].trava);
+    particoes[preferida].heap.insereEventos(buffer.eventos, buffer.tamanho);
+    buffer.tamanho = 0;
+}
+
+Evento EscalonadorConcorrente::retiraProximoEvento() {
+    int p = particaoMinima();
+    if (p == -1) {
+        throw std::runtime_error("Escalonador vazio");
+    }
+    return particoes[p].heap.retiraProximoEvento();
+}
+
+bool EscalonadorConcorrente::vazio() const {
+    return particaoMinima() == -1;
+}
+
+int EscalonadorConcorrente::getTamanho() const {
+    int total = 0;
+    for (int p = 0; p < numParticoes; p++) {
+        total += particoes[p].heap.getTamanho();
+    }
+    return total;
+}
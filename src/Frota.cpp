@@ -0,0 +1,296 @@
+#include "Frota.hpp"
+#include "Memoria.hpp"
+#include <cmath>
+#include <stdexcept>
+
+// Lado, em células, de cada bloco do nível grosso do índice espacial
+const int LADO_BLOCO = 4;
+
+// ==================== Métodos Privados ====================
+
+void Frota::localizarCelula(const Coordenada& coord, int& coluna, int& linha) const {
+    coluna = (int)((coord.x - xMin) / tamCelula);
+    linha = (int)((coord.y - yMin) / tamCelula);
+
+    // Coordenadas fora da área são atribuídas à célula da borda
+    if (coluna < 0) coluna = 0;
+    if (coluna >= colunas) coluna = colunas - 1;
+    if (linha < 0) linha = 0;
+    if (linha >= linhas) linha = linhas - 1;
+}
+
+int Frota::blocoDaCelula(int celula) const {
+    int linha = celula / colunas;
+    int coluna = celula % colunas;
+    return (linha / LADO_BLOCO) * blocoColunas + coluna / LADO_BLOCO;
+}
+
+void Frota::compararCandidato(int v, const Coordenada& pos, int& melhor,
+                              double& melhorDist) const {
+    double dist = calcularDistancia(veiculos[v].posicao, pos);
+    if (melhor == -1 || dist < melhorDist || (dist == melhorDist && v < melhor)) {
+        melhor = v;
+        melhorDist = dist;
+    }
+}
+
+void Frota::insereNoIndice(int v) {
+    int coluna, linha;
+    localizarCelula(veiculos[v].posicao, coluna, linha);
+    int celula = linha * colunas + coluna;
+
+    // Insere no início da lista da célula
+    celulaDoVeiculo[v] = celula;
+    anterior[v] = -1;
+    proximo[v] = primeiroDaCelula[celula];
+    if (primeiroDaCelula[celula] != -1) {
+        anterior[primeiroDaCelula[celula]] = v;
+    }
+    primeiroDaCelula[celula] = v;
+    livresDoBloco[blocoDaCelula(celula)]++;
+
+    // Anexa ao conjunto denso
+    posicaoLivre[v] = numLivres;
+    livres[numLivres] = v;
+
+    veiculos[v].livre = true;
+    numLivres++;
+}
+
+void Frota::removeDoIndice(int v) {
+    if (anterior[v] != -1) {
+        proximo[anterior[v]] = proximo[v];
+    } else {
+        primeiroDaCelula[celulaDoVeiculo[v]] = proximo[v];
+    }
+    if (proximo[v] != -1) {
+        anterior[proximo[v]] = anterior[v];
+    }
+    livresDoBloco[blocoDaCelula(celulaDoVeiculo[v])]--;
+
+    // Remove do conjunto denso trazendo o último para a posição de v
+    int ultimo = livres[numLivres - 1];
+    livres[posicaoLivre[v]] = ultimo;
+    posicaoLivre[ultimo] = posicaoLivre[v];
+
+    veiculos[v].livre = false;
+    numLivres--;
+}
+
+void Frota::liberar(const Evento& evento) {
+    int v = veiculoDaCorrida[evento.idCorrida];
+    veiculoDaCorrida[evento.idCorrida] = -1;
+    veiculos[v].tempoDisponivel = evento.tempo;
+    insereNoIndice(v);
+}
+
+// ==================== Métodos Públicos ====================
+
+Frota::Frota(int numVeiculos, int maxCorridas, Coordenada minimo, Coordenada maximo)
+    : numVeiculos(numVeiculos), numLivres(0), xMin(minimo.x), yMin(minimo.y),
+      liberacoes(100, MEM_FROTA), maxCorridas(maxCorridas) {
+    if (numVeiculos <= 0) {
+        throw std::invalid_argument("Frota sem veiculos");
+    }
+
+    // Grade quadrada com aproximadamente um veículo por célula
+    double largura = maximo.x - minimo.x;
+    double altura = maximo.y - minimo.y;
+    double lado = (largura > altura) ? largura : altura;
+    int divisoes = (int)ceil(sqrt((double)numVeiculos));
+
+    tamCelula = (lado > 0.0) ? lado / divisoes : 1.0;
+    colunas = (int)(largura / tamCelula) + 1;
+    linhas = (int)(altura / tamCelula) + 1;
+
+    primeiroDaCelula = alocarArray<int>(colunas * linhas, MEM_FROTA);
+    for (int c = 0; c < colunas * linhas; c++) {
+        primeiroDaCelula[c] = -1;
+    }
+
+    blocoColunas = (colunas + LADO_BLOCO - 1) / LADO_BLOCO;
+    blocoLinhas = (linhas + LADO_BLOCO - 1) / LADO_BLOCO;
+    livresDoBloco = alocarArray<int>(blocoColunas * blocoLinhas, MEM_FROTA);
+    for (int b = 0; b < blocoColunas * blocoLinhas; b++) {
+        livresDoBloco[b] = 0;
+    }
+
+    veiculos = alocarArray<Veiculo>(numVeiculos, MEM_FROTA);
+    proximo = alocarArray<int>(numVeiculos, MEM_FROTA);
+    anterior = alocarArray<int>(numVeiculos, MEM_FROTA);
+    celulaDoVeiculo = alocarArray<int>(numVeiculos, MEM_FROTA);
+    livres = alocarArray<int>(numVeiculos, MEM_FROTA);
+    posicaoLivre = alocarArray<int>(numVeiculos, MEM_FROTA);
+    for (int v = 0; v < numVeiculos; v++) {
+        veiculos[v].posicao = minimo;
+        veiculos[v].tempoDisponivel = 0.0;
+        insereNoIndice(v);
+    }
+
+    veiculoDaCorrida = alocarArray<int>(maxCorridas, MEM_FROTA);
+    for (int i = 0; i < maxCorridas; i++) {
+        veiculoDaCorrida[i] = -1;
+    }
+}
+
+Frota::~Frota() {
+    liberarArray(veiculos);
+    liberarArray(proximo);
+    liberarArray(anterior);
+    liberarArray(celulaDoVeiculo);
+    liberarArray(primeiroDaCelula);
+    liberarArray(livresDoBloco);
+    liberarArray(livres);
+    liberarArray(posicaoLivre);
+    liberarArray(veiculoDaCorrida);
+}
+
+void Frota::posicionarVeiculo(int v, const Coordenada& pos) {
+    if (!veiculos[v].livre) {
+        throw std::logic_error("Veiculo ocupado nao pode ser reposicionado");
+    }
+    removeDoIndice(v);
+    veiculos[v].posicao = pos;
+    insereNoIndice(v);
+}
+
+template <int LADO>
+void Frota::buscarEmAneis(const Coordenada& pos, int& melhor, double& melhorDist) const {
+    // Grade vista em unidades de LADO x LADO células
+    int colunasNivel = (colunas + LADO - 1) / LADO;
+    int linhasNivel = (linhas + LADO - 1) / LADO;
+    double tamUnidade = LADO * tamCelula;
+
+    int colunaCentro, linhaCentro;
+    localizarCelula(pos, colunaCentro, linhaCentro);
+    colunaCentro /= LADO;
+    linhaCentro /= LADO;
+    int raioMaximo = (colunasNivel > linhasNivel) ? colunasNivel : linhasNivel;
+
+    // Percorre anéis de unidades ao redor da unidade da coleta. Antes do anel r,
+    // tudo o que falta examinar está fora do quadrado formado pelos anéis
+    // 0..r-1; se o melhor veículo está mais perto que essa borda, a busca acaba.
+    for (int r = 0; r <= raioMaximo; r++) {
+        if (melhor != -1 && r > 0) {
+            double esquerda = pos.x - (xMin + (colunaCentro - r + 1) * tamUnidade);
+            double direita = xMin + (colunaCentro + r) * tamUnidade - pos.x;
+            double abaixo = pos.y - (yMin + (linhaCentro - r + 1) * tamUnidade);
+            double acima = yMin + (linhaCentro + r) * tamUnidade - pos.y;
+
+            double borda = esquerda;
+            if (direita < borda) borda = direita;
+            if (abaixo < borda) borda = abaixo;
+            if (acima < borda) borda = acima;
+
+            // Estrito: um veículo exatamente na borda ainda pode empatar
+            if (melhorDist < borda) {
+                break;
+            }
+        }
+
+        for (int ul = linhaCentro - r; ul <= linhaCentro + r; ul++) {
+            if (ul < 0 || ul >= linhasNivel) continue;
+
+            // Nas linhas internas do anel, apenas as duas colunas da borda
+            bool borda = (ul == linhaCentro - r || ul == linhaCentro + r);
+            int passo = (borda || r == 0) ? 1 : 2 * r;
+
+            for (int uc = colunaCentro - r; uc <= colunaCentro + r; uc += passo) {
+                if (uc < 0 || uc >= colunasNivel) continue;
+
+                if (LADO == 1) {
+                    for (int v = primeiroDaCelula[ul * colunas + uc]; v != -1; v = proximo[v]) {
+                        compararCandidato(v, pos, melhor, melhorDist);
+                    }
+                    continue;
+                }
+
+                // Blocos sem veículos livres são pulados sem visitar suas células
+                if (livresDoBloco[ul * blocoColunas + uc] == 0) {
+                    continue;
+                }
+
+                int linhaFim = (ul + 1) * LADO;
+                if (linhaFim > linhas) linhaFim = linhas;
+                int colunaFim = (uc + 1) * LADO;
+                if (colunaFim > colunas) colunaFim = colunas;
+
+                for (int linha = ul * LADO; linha < linhaFim; linha++) {
+                    for (int coluna = uc * LADO; coluna < colunaFim; coluna++) {
+                        for (int v = primeiroDaCelula[linha * colunas + coluna]; v != -1;
+                             v = proximo[v]) {
+                            compararCandidato(v, pos, melhor, melhorDist);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int Frota::despacharMaisProximo(const Coordenada& pos) {
+    if (numLivres == 0) {
+        return -1;
+    }
+
+    int melhor = -1;
+    double melhorDist = 0.0;
+    long long numCelulas = (long long)colunas * linhas;
+
+    if ((long long)numLivres * numLivres <= numCelulas) {
+        // Poucos livres: percorrer o conjunto denso custa menos que a área
+        // esperada de busca na grade (cerca de células / numLivres)
+        for (int k = 0; k < numLivres; k++) {
+            compararCandidato(livres[k], pos, melhor, melhorDist);
+        }
+    } else if ((long long)numLivres * LADO_BLOCO * LADO_BLOCO < numCelulas) {
+        // Menos de um livre por bloco: anéis de blocos pulam as regiões vazias
+        buscarEmAneis<LADO_BLOCO>(pos, melhor, melhorDist);
+    } else {
+        // Frota com muitos livres: anéis de células param logo
+        buscarEmAneis<1>(pos, melhor, melhorDist);
+    }
+
+    removeDoIndice(melhor);
+    return melhor;
+}
+
+void Frota::ocuparVeiculo(int v, const Evento& entregaFinal, const Coordenada& posFinal) {
+    if (entregaFinal.idCorrida < 0 || entregaFinal.idCorrida >= maxCorridas) {
+        throw std::out_of_range("Corrida fora dos limites da frota");
+    }
+    if (veiculoDaCorrida[entregaFinal.idCorrida] != -1) {
+        // A liberação pendente soltaria o veículo errado
+        throw std::logic_error("Corrida com liberacao pendente");
+    }
+
+    veiculos[v].posicao = posFinal;
+    veiculos[v].tempoDisponivel = entregaFinal.tempo;
+    veiculoDaCorrida[entregaFinal.idCorrida] = v;
+    liberacoes.insereEvento(entregaFinal);
+}
+
+void Frota::liberarAte(double tempo) {
+    while (!liberacoes.vazio() && liberacoes.proximoEvento().tempo <= tempo) {
+        liberar(liberacoes.retiraProximoEvento());
+    }
+}
+
+double Frota::liberarProximo() {
+    Evento evento = liberacoes.retiraProximoEvento();
+    liberar(evento);
+    liberarAte(evento.tempo);
+    return evento.tempo;
+}
+
+int Frota::getNumVeiculos() const {
+    return numVeiculos;
+}
+
+int Frota::getNumLivres() const {
+    return numLivres;
+}
+
+const Veiculo& Frota::getVeiculo(int v) const {
+    return veiculos[v];
+}
@@ -0,0 +1,117 @@
+#include "Memoria.hpp"
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <unistd.h>
+
+// ==================== Contadores ====================
+
+namespace {
+
+const char* NOMES_SUBSISTEMAS[NUM_SUBSISTEMAS] = {
+    "demandas", "corridas", "escalonador", "paradas", "frota"
+};
+
+std::atomic<long long> bytesVivos[NUM_SUBSISTEMAS];
+std::atomic<long long> picoBytes[NUM_SUBSISTEMAS];
+std::atomic<long long> numAlocacoes[NUM_SUBSISTEMAS];
+std::atomic<long long> totalVivos(0);
+std::atomic<long long> picoTotal(0);
+
+void atualizarPico(std::atomic<long long>& pico, long long valor) {
+    long long atual = pico.load(std::memory_order_relaxed);
+    while (valor > atual &&
+           !pico.compare_exchange_weak(atual, valor, std::memory_order_relaxed)) {
+    }
+}
+
+// ==================== Escrita sem alocação ====================
+
+void escreverTexto(int fd, const char* texto) {
+    std::size_t tamanho = 0;
+    while (texto[tamanho] != '\0') tamanho++;
+    ssize_t escrito = write(fd, texto, tamanho);
+    (void)escrito;
+}
+
+void escreverNumero(int fd, long long valor, int largura) {
+    char buffer[32];
+    int pos = sizeof(buffer);
+    bool negativo = valor < 0;
+    unsigned long long absoluto = negativo ? -(unsigned long long)valor : valor;
+
+    do {
+        buffer[--pos] = (char)('0' + absoluto % 10);
+        absoluto /= 10;
+    } while (absoluto > 0);
+    if (negativo) buffer[--pos] = '-';
+
+    while ((int)sizeof(buffer) - pos < largura && pos > 0) {
+        buffer[--pos] = ' ';
+    }
+    ssize_t escrito = write(fd, buffer + pos, sizeof(buffer) - pos);
+    (void)escrito;
+}
+
+void escreverLinha(int fd, const char* nome, long long vivos, long long pico,
+                   long long alocacoes) {
+    escreverTexto(fd, "  ");
+    escreverTexto(fd, nome);
+    std::size_t tamanho = 0;
+    while (nome[tamanho] != '\0') tamanho++;
+    for (std::size_t i = tamanho; i < 12; i++) escreverTexto(fd, " ");
+    escreverNumero(fd, vivos, 14);
+    escreverNumero(fd, pico, 14);
+    escreverNumero(fd, alocacoes, 12);
+    escreverTexto(fd, "\n");
+}
+
+void relatorioAoSair() {
+    imprimirRelatorioMemoria(STDERR_FILENO);
+}
+
+void relatorioPorSinal(int) {
+    imprimirRelatorioMemoria(STDERR_FILENO);
+}
+
+} // namespace
+
+// ==================== Implementação ====================
+
+void registrarAlocacao(Subsistema subsistema, std::size_t bytes) {
+    long long valor = (long long)bytes;
+    long long vivos = bytesVivos[subsistema].fetch_add(valor, std::memory_order_relaxed) + valor;
+    atualizarPico(picoBytes[subsistema], vivos);
+    numAlocacoes[subsistema].fetch_add(1, std::memory_order_relaxed);
+
+    long long total = totalVivos.fetch_add(valor, std::memory_order_relaxed) + valor;
+    atualizarPico(picoTotal, total);
+}
+
+void registrarLiberacao(Subsistema subsistema, std::size_t bytes) {
+    long long valor = (long long)bytes;
+    bytesVivos[subsistema].fetch_sub(valor, std::memory_order_relaxed);
+    totalVivos.fetch_sub(valor, std::memory_order_relaxed);
+}
+
+void imprimirRelatorioMemoria(int fd) {
+    escreverTexto(fd, "Memoria por subsistema (bytes):\n");
+    escreverTexto(fd, "  subsistema           vivos          pico   alocacoes\n");
+
+    long long alocacoesTotal = 0;
+    for (int s = 0; s < NUM_SUBSISTEMAS; s++) {
+        long long alocacoes = numAlocacoes[s].load(std::memory_order_relaxed);
+        alocacoesTotal += alocacoes;
+        escreverLinha(fd, NOMES_SUBSISTEMAS[s],
+                      bytesVivos[s].load(std::memory_order_relaxed),
+                      picoBytes[s].load(std::memory_order_relaxed), alocacoes);
+    }
+
+    escreverLinha(fd, "total", totalVivos.load(std::memory_order_relaxed),
+                  picoTotal.load(std::memory_order_relaxed), alocacoesTotal);
+}
+
+void instalarRelatorioMemoria() {
+    std::atexit(relatorioAoSair);
+    std::signal(SIGUSR1, relatorioPorSinal);
+}
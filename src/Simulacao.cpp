@@ -0,0 +1,580 @@
+#include "Simulacao.hpp"
+#include "Frota.hpp"
+#include "Memoria.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <chrono>
+
+using namespace std;
+
+namespace {
+
+// Número de eventos retirados do escalonador por chamada na Fase 2
+const int TAMANHO_LOTE_EVENTOS = 1024;
+
+// Folga relativa ao comparar quadrados de distâncias: fora dela o resultado
+// coincide com o da comparação feita após a raiz quadrada
+const double MARGEM_RAIO = 1e-9;
+
+/**
+ * @brief Verifica se a distância entre dois pontos não excede o raio
+ *
+ * Compara o quadrado da distância com raio^2 e só calcula a raiz quando o
+ * valor cai na faixa de arredondamento em torno do raio, preservando o
+ * resultado de calcularDistancia(p1, p2) <= raio.
+ *
+ * @param p1 Primeira coordenada
+ * @param p2 Segunda coordenada
+ * @param raio Distância máxima
+ * @return true se a distância for no máximo raio
+ */
+bool dentroDoRaio(const Coordenada& p1, const Coordenada& p2, double raio) {
+    if (raio < 0.0) return false;
+
+    double dx = p2.x - p1.x;
+    double dy = p2.y - p1.y;
+    double quadrado = dx * dx + dy * dy;
+    double raioQuadrado = raio * raio;
+
+    if (quadrado < raioQuadrado * (1.0 - MARGEM_RAIO)) return true;
+    if (quadrado > raioQuadrado * (1.0 + MARGEM_RAIO)) return false;
+    return sqrt(quadrado) <= raio;
+}
+
+/**
+ * @brief Verifica se duas demandas podem ser combinadas
+ * @param d1 Primeira demanda
+ * @param d2 Segunda demanda
+ * @param alfa Distância máxima entre origens
+ * @param beta Distância máxima entre destinos
+ * @return true se podem ser combinadas
+ */
+bool podeCombinar(const Demanda& d1, const Demanda& d2, double alfa, double beta) {
+    // Origens primeiro: se já falham, os destinos não são comparados
+    if (!dentroDoRaio(d1.getOrigem(), d2.getOrigem(), alfa)) {
+        return false;
+    }
+    return dentroDoRaio(d1.getDestino(), d2.getDestino(), beta);
+}
+
+/**
+ * @brief Verifica se nova demanda pode ser adicionada ao grupo
+ * @param demandas Array de todas demandas
+ * @param grupo Array de índices das demandas no grupo atual
+ * @param tamGrupo Tamanho do grupo
+ * @param novaDemanda Índice da demanda a ser testada
+ * @param alfa Critério de distância entre origens
+ * @param beta Critério de distância entre destinos
+ * @return true se pode adicionar
+ */
+bool podeAdicionarAoGrupo(Demanda* demandas, int* grupo, int tamGrupo, 
+                          int novaDemanda, double alfa, double beta) {
+    // Verifica se a nova demanda satisfaz critérios com TODAS do grupo
+    for (int i = 0; i < tamGrupo; i++) {
+        if (!podeCombinar(demandas[grupo[i]], demandas[novaDemanda], alfa, beta)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Calcula eficiência de uma corrida compartilhada
+ * @param demandas Array de demandas
+ * @param grupo Índices das demandas na corrida
+ * @param tamGrupo Número de demandas
+ * @param distRota Se não nulo, recebe a distância total da rota calculada
+ * @return Eficiência em porcentagem
+ */
+double calcularEficienciaGrupo(Demanda* demandas, int* grupo, int tamGrupo,
+                               double* distRota = nullptr) {
+    if (tamGrupo <= 1) return 1;
+
+    // Distância do trecho principal (soma das demandas avulsas)
+    double distPrincipal = 0;
+    for (int i=0; i < tamGrupo; i++){
+        distPrincipal += demandas[grupo[i]].calcularDistanciaViagem();
+    }
+    // Calcular distância total da rota: origem[0] -> origens[1..n] -> destinos[0..n]
+    double distTotal = 0.0;
+    Coordenada posAtual = demandas[grupo[0]].getOrigem();
+
+    // Fase de coletas: visitar origens das demais demandas
+    for (int i = 1; i < tamGrupo; i++) {
+        Coordenada proxOrigem = demandas[grupo[i]].getOrigem();
+        distTotal += calcularDistancia(posAtual, proxOrigem);
+        posAtual = proxOrigem;
+    }
+
+    // Fase de entregas: visitar todos os destinos
+    for (int i = 0; i < tamGrupo; i++) {
+        Coordenada destino = demandas[grupo[i]].getDestino();
+        distTotal += calcularDistancia(posAtual, destino);
+        posAtual = destino;
+    }
+
+    if (distRota != nullptr) {
+        *distRota = distTotal;
+    }
+
+    if (distTotal == 0.0) return 0.0;
+
+    return (distPrincipal / distTotal);
+}
+
+// Folga relativa do pré-filtro: absorve diferenças de arredondamento entre a
+// rota estimada e a soma feita por calcularEficienciaGrupo
+const double MARGEM_LIMITE = 1e-9;
+
+/**
+ * @brief Pré-filtro conservador de eficiência antes do cálculo da rota completa
+ *
+ * Acrescentar novaDemanda ao final do grupo troca o trecho
+ * ultimaOrigem -> primeiroDestino por ultimaOrigem -> novaOrigem -> primeiroDestino
+ * e adiciona o trecho ultimoDestino -> novoDestino. A nova rota mede
+ * exatamente distRotaGrupo - dist(ultimaOrigem, primeiroDestino)
+ * + dist(ultimaOrigem, novaOrigem) + dist(novaOrigem, primeiroDestino)
+ * + dist(ultimoDestino, novoDestino); só o arredondamento difere da soma
+ * completa, e MARGEM_LIMITE o cobre.
+ *
+ * @param demandas Array de todas demandas
+ * @param grupo Array de índices das demandas no grupo atual
+ * @param tamGrupo Tamanho do grupo
+ * @param novaDemanda Índice da demanda candidata
+ * @param distPrincipalGrupo Soma das distâncias avulsas das demandas do grupo
+ * @param distRotaGrupo Distância da rota atual do grupo
+ * @param lambda Eficiência mínima
+ * @return true se o grupo estendido certamente não supera lambda
+ * Complexidade: O(1)
+ */
+bool descartaPorLimiteInferior(Demanda* demandas, int* grupo, int tamGrupo,
+                               int novaDemanda, double distPrincipalGrupo,
+                               double distRotaGrupo, double lambda) {
+    if (lambda <= 0.0) return false;
+
+    const Demanda& nova = demandas[novaDemanda];
+    Coordenada ultimaOrigem = demandas[grupo[tamGrupo - 1]].getOrigem();
+    Coordenada primeiroDestino = demandas[grupo[0]].getDestino();
+
+    double distPrincipal = distPrincipalGrupo + nova.calcularDistanciaViagem();
+    double distRota = distRotaGrupo
+        - calcularDistancia(ultimaOrigem, primeiroDestino)
+        + nova.distanciaOrigem(ultimaOrigem)
+        + nova.distanciaOrigem(primeiroDestino)
+        + nova.distanciaDestino(demandas[grupo[tamGrupo - 1]].getDestino());
+
+    // eficiencia = distPrincipal / distRota, a menos do arredondamento
+    return distPrincipal < lambda * distRota * (1.0 - MARGEM_LIMITE);
+}
+
+/**
+ * @brief Remove elemento de uma lista duplamente encadeada em arrays
+ * @param proximo Array de sucessores
+ * @param anterior Array de predecessores
+ * @param i Elemento a remover (seus próprios ponteiros são preservados)
+ * Complexidade: O(1)
+ */
+void removerDaLista(int* proximo, int* anterior, int i) {
+    proximo[anterior[i]] = proximo[i];
+    anterior[proximo[i]] = anterior[i];
+}
+
+} // namespace
+
+// ==================== ContextoSimulacao ====================
+
+ContextoSimulacao::ContextoSimulacao()
+    : capacidade(0), capacidadeGrupo(0), demandas(nullptr), proximoLivre(nullptr),
+      anteriorLivre(nullptr),
+      corridas(nullptr), grupo(nullptr), eventos(nullptr), tempoConclusao(nullptr),
+      paradasPorCorrida(nullptr), corridaConcluida(nullptr), inicioParadas(nullptr),
+      paradas(nullptr) {
+}
+
+ContextoSimulacao::~ContextoSimulacao() {
+    liberarArray(demandas);
+    liberarArray(proximoLivre);
+    liberarArray(anteriorLivre);
+    liberarArray(corridas);
+    liberarArray(grupo);
+    liberarArray(eventos);
+    liberarArray(tempoConclusao);
+    liberarArray(paradasPorCorrida);
+    liberarArray(corridaConcluida);
+    liberarArray(inicioParadas);
+    liberarArray(paradas);
+}
+
+void ContextoSimulacao::reservar(int numDemandas, int eta) {
+    if (eta > capacidadeGrupo) {
+        liberarArray(grupo);
+        grupo = alocarArray<int>(eta, MEM_CORRIDAS);
+        capacidadeGrupo = eta;
+    }
+
+    escalonador.limpar();
+    // Só retorna cedo depois da primeira alocação: mesmo com capacidade zero a
+    // lista de livres precisa da posição da sentinela
+    if (numDemandas <= capacidade && demandas != nullptr) {
+        return;
+    }
+
+    liberarArray(demandas);
+    liberarArray(proximoLivre);
+    liberarArray(anteriorLivre);
+    liberarArray(corridas);
+    liberarArray(eventos);
+    liberarArray(tempoConclusao);
+    liberarArray(paradasPorCorrida);
+    liberarArray(corridaConcluida);
+    liberarArray(inicioParadas);
+    liberarArray(paradas);
+
+    if (numDemandas > capacidade) {
+        capacidade = numDemandas;
+    }
+
+    demandas = alocarArray<Demanda>(capacidade, MEM_DEMANDAS);
+    proximoLivre = alocarArray<int>(capacidade + 1, MEM_DEMANDAS);
+    anteriorLivre = alocarArray<int>(capacidade + 1, MEM_DEMANDAS);
+    corridas = alocarArray<InfoCorrida>(capacidade, MEM_CORRIDAS);
+    eventos = alocarArray<Evento>(2 * capacidade, MEM_ESCALONADOR);
+    tempoConclusao = alocarArray<double>(capacidade, MEM_CORRIDAS);
+    paradasPorCorrida = alocarArray<int>(capacidade, MEM_CORRIDAS);
+    corridaConcluida = alocarArray<bool>(capacidade, MEM_CORRIDAS);
+    inicioParadas = alocarArray<int>(capacidade, MEM_PARADAS);
+    paradas = alocarArray<Coordenada>(2 * capacidade, MEM_PARADAS);
+
+    escalonador.reservar(2 * capacidade);
+}
+
+// ==================== Simulação ====================
+
+bool simular(istream& entrada, ostream& saida, ContextoSimulacao& ctx,
+             int numVeiculos, bool rastrear, ResultadoSimulacao& resultado) {
+    // Leitura dos parâmetros
+    int eta;           // Capacidade dos veículos
+    double gama;       // Velocidade dos veículos
+    double delta;      // Intervalo temporal máximo
+    double alfa;       // Distância máxima entre origens
+    double beta;       // Distância máxima entre destinos
+    double lambda;     // Eficiência mínima
+
+    // Leitura das demandas
+    int numDemandas;
+    if (!(entrada >> eta >> gama >> delta >> alfa >> beta >> lambda >> numDemandas) ||
+        eta <= 0 || numDemandas < 0) {
+        return false;
+    }
+
+    ctx.reservar(numDemandas, eta);
+    Demanda* demandas = ctx.demandas;
+
+    for (int i = 0; i < numDemandas; i++) {
+        int id;
+        double tempo;
+        Coordenada origem, destino;
+
+        if (!(entrada >> id >> tempo >> origem.x >> origem.y >> destino.x >> destino.y)) {
+            return false;
+        }
+        demandas[i] = Demanda(id, tempo, origem, destino);
+    }
+
+    // Lista duplamente encadeada das demandas ainda não atribuídas a corridas,
+    // em ordem de índice; a posição numDemandas é a sentinela de início e fim
+    int* proximoLivre = ctx.proximoLivre;
+    int* anteriorLivre = ctx.anteriorLivre;
+    int sentinela = numDemandas;
+    for (int i = 0; i <= numDemandas; i++) {
+        proximoLivre[i] = (i + 1) % (numDemandas + 1);
+        anteriorLivre[i] = (i + numDemandas) % (numDemandas + 1);
+    }
+
+    // Array para armazenar corridas criadas (no máximo numDemandas corridas)
+    InfoCorrida* corridas = ctx.corridas;
+    int numCorridas = 0;
+
+    // Escalonador para eventos
+    Escalonador& escalonador = ctx.escalonador;
+
+    // Eventos da Fase 1 são acumulados e carregados de uma vez no escalonador;
+    // o mesmo buffer recebe os lotes retirados na Fase 2
+    Evento* eventos = ctx.eventos;
+    int numEventos = 0;
+
+    // Estatísticas do pré-filtro de eficiência
+    long long candidatosEficiencia = 0;
+    long long avaliacoesEvitadas = 0;
+
+    // Frota finita: veículos partem das origens das demandas, espalhados no tempo
+    Frota* frota = nullptr;
+    if (numVeiculos > 0 && numDemandas > 0) {
+        Coordenada minimo = demandas[0].getOrigem();
+        Coordenada maximo = minimo;
+        for (int i = 0; i < numDemandas; i++) {
+            Coordenada pontos[2] = {demandas[i].getOrigem(), demandas[i].getDestino()};
+            for (int p = 0; p < 2; p++) {
+                if (pontos[p].x < minimo.x) minimo.x = pontos[p].x;
+                if (pontos[p].y < minimo.y) minimo.y = pontos[p].y;
+                if (pontos[p].x > maximo.x) maximo.x = pontos[p].x;
+                if (pontos[p].y > maximo.y) maximo.y = pontos[p].y;
+            }
+        }
+
+        frota = new Frota(numVeiculos, numDemandas, minimo, maximo);
+        for (int v = 0; v < numVeiculos; v++) {
+            int d = (int)((long long)v * numDemandas / numVeiculos);
+            frota->posicionarVeiculo(v, demandas[d].getOrigem());
+        }
+    }
+
+    // Estatísticas do despacho
+    long long corridasComEspera = 0;
+    double distAproximacao = 0.0;
+    double tempoEspera = 0.0;
+    double latenciaDespacho = 0.0;     // Segundos
+    double latenciaMaxima = 0.0;       // Segundos
+
+    // ========== FASE 1: COMBINAÇÃO DE CORRIDAS ==========
+
+    // A primeira demanda livre inicia cada corrida; as anteriores já têm corrida
+    while (proximoLivre[sentinela] != sentinela) {
+        int i = proximoLivre[sentinela];
+
+        // Criar novo grupo de corrida começando com demanda i
+        int* grupo = ctx.grupo;  // Máximo eta passageiros
+        grupo[0] = i;
+        int tamGrupo = 1;
+        removerDaLista(proximoLivre, anteriorLivre, i);
+
+        double tempoBase = demandas[i].getTempoSolicitacao();
+
+        // Distâncias acumuladas do grupo, usadas pelo pré-filtro
+        double distPrincipalGrupo = demandas[i].calcularDistanciaViagem();
+        double distRotaGrupo = distPrincipalGrupo;
+
+        // Tentar adicionar outras demandas ao grupo
+        // Só percorre demandas livres; j removida mantém seu próximo válido
+        for (int j = proximoLivre[i]; j != sentinela; j = proximoLivre[j]) {
+            // Verificar se grupo já está cheio
+            if (tamGrupo >= eta) {
+                break;
+            }
+
+            // Verificar intervalo temporal (critério delta)
+            double diffTempo = demandas[j].getTempoSolicitacao() - tempoBase;
+            if (diffTempo >= delta) {
+                break;  // Demandas estão ordenadas por tempo, pode parar
+            }
+
+            // Verificar se pode combinar com todas do grupo (critérios alfa e beta)
+            if (!podeAdicionarAoGrupo(demandas, grupo, tamGrupo, j, alfa, beta)) {
+                continue;  // Não pode combinar, tenta próxima
+            }
+
+            // Descartar sem calcular a rota se a eficiência não pode superar lambda
+            if (!rastrear) {
+                candidatosEficiencia++;
+                if (descartaPorLimiteInferior(demandas, grupo, tamGrupo, j,
+                                              distPrincipalGrupo, distRotaGrupo, lambda)) {
+                    avaliacoesEvitadas++;
+                    continue;
+                }
+            }
+
+            // Adicionar temporariamente ao grupo
+            grupo[tamGrupo] = j;
+            tamGrupo++;
+
+            // Verificar eficiência
+            double distRotaCandidata = 0.0;
+            double eficiencia = calcularEficienciaGrupo(demandas, grupo, tamGrupo,
+                                                        &distRotaCandidata);
+            if (rastrear) {
+                saida << "Representantes: " << i  << ", " << j << " | Eficiência: " << eficiencia << endl;
+            }
+
+            if (eficiencia <= lambda) {
+                // Eficiência insuficiente, remover última demanda
+                tamGrupo--;
+                // Não interrompe busca - tenta próximas demandas
+            } else {
+                // Aceita a demanda no grupo
+                removerDaLista(proximoLivre, anteriorLivre, j);
+                distPrincipalGrupo += demandas[j].calcularDistanciaViagem();
+                distRotaGrupo = distRotaCandidata;
+            }
+        }
+
+        // Criar corrida com o grupo formado
+        InfoCorrida& corrida = corridas[numCorridas];
+        corrida.limpar();
+        for (int k = 0; k < tamGrupo; k++) {
+            corrida.adicionarDemanda(grupo[k]);
+
+            // Atualizar estado da demanda
+            if (tamGrupo == 1) {
+                demandas[grupo[k]].setEstado(INDIVIDUAL);
+            } else {
+                demandas[grupo[k]].setEstado(COMBINADA);
+            }
+        }
+
+        corrida.calcularRota(demandas, gama);
+
+        // Escalonar eventos de coleta e entrega
+        double tempoAtual = corrida.tempoInicio;
+        Coordenada posAtual = demandas[corrida.demandasIds[0]].getOrigem();
+
+        // Com frota finita, a corrida começa quando o veículo livre mais
+        // próximo chega à primeira coleta
+        int veiculo = -1;
+        if (frota != nullptr) {
+            chrono::steady_clock::time_point inicioDespacho = chrono::steady_clock::now();
+
+            frota->liberarAte(corrida.tempoInicio);
+            if (frota->getNumLivres() == 0) {
+                frota->liberarProximo();
+                corridasComEspera++;
+            }
+            veiculo = frota->despacharMaisProximo(posAtual);
+
+            double latencia = chrono::duration<double>(
+                chrono::steady_clock::now() - inicioDespacho).count();
+            latenciaDespacho += latencia;
+            if (latencia > latenciaMaxima) latenciaMaxima = latencia;
+
+            const Veiculo& v = frota->getVeiculo(veiculo);
+            double aproximacao = calcularDistancia(v.posicao, posAtual);
+            double partida = (v.tempoDisponivel > tempoAtual) ? v.tempoDisponivel : tempoAtual;
+            distAproximacao += aproximacao;
+            tempoAtual = partida + aproximacao / gama;
+            tempoEspera += tempoAtual - corrida.tempoInicio;
+        }
+
+        // Eventos de coleta
+        for (int k = 0; k < corrida.numDemandas; k++) {
+            Coordenada destColeta = demandas[corrida.demandasIds[k]].getOrigem();
+            double distancia = calcularDistancia(posAtual, destColeta);
+            tempoAtual += distancia / gama;
+
+            Evento eventoColeta = {tempoAtual, COLETA, numCorridas, 
+                                   corrida.demandasIds[k], k};
+            eventos[numEventos++] = eventoColeta;
+
+            posAtual = destColeta;
+        }
+
+        // Eventos de entrega
+        for (int k = 0; k < corrida.numDemandas; k++) {
+            Coordenada destEntrega = demandas[corrida.demandasIds[k]].getDestino();
+            double distancia = calcularDistancia(posAtual, destEntrega);
+            tempoAtual += distancia / gama;
+
+            Evento eventoEntrega = {tempoAtual, ENTREGA, numCorridas, 
+                                    corrida.demandasIds[k], k};
+            eventos[numEventos++] = eventoEntrega;
+
+            posAtual = destEntrega;
+
+            // Veículo fica ocupado até a última entrega
+            if (veiculo != -1 && k == corrida.numDemandas - 1) {
+                frota->ocuparVeiculo(veiculo, eventoEntrega, destEntrega);
+            }
+        }
+
+        numCorridas++;
+    }
+
+    // Construção do heap de baixo para cima: O(n) em vez de n inserções O(log n)
+    escalonador.insereEventos(eventos, numEventos);
+
+    // ========== FASE 2: PROCESSAMENTO DE EVENTOS E SAÍDA ==========
+
+    // Array para controlar quando cada corrida foi concluída
+    double* tempoConclusao = ctx.tempoConclusao;
+    int* paradasPorCorrida = ctx.paradasPorCorrida;
+    bool* corridaConcluida = ctx.corridaConcluida;
+
+    // Paradas de cada corrida, contíguas em um único array
+    int* inicioParadas = ctx.inicioParadas;
+    Coordenada* paradas = ctx.paradas;
+    int totalParadas = 0;
+
+    for (int i = 0; i < numCorridas; i++) {
+        tempoConclusao[i] = 0.0;
+        paradasPorCorrida[i] = 0;
+        corridaConcluida[i] = false;
+
+        // Máximo de paradas: numDemandas coletas + numDemandas entregas
+        inicioParadas[i] = totalParadas;
+        totalParadas += corridas[i].numDemandas * 2;
+    }
+
+    // Processar eventos em lotes, em ordem de tempo
+    int tamanhoLote = (numEventos < TAMANHO_LOTE_EVENTOS) ? numEventos : TAMANHO_LOTE_EVENTOS;
+    int numLote;
+    while ((numLote = escalonador.retiraEventos(eventos, tamanhoLote)) > 0) {
+        for (int e = 0; e < numLote; e++) {
+            const Evento& evento = eventos[e];
+            int idCorrida = evento.idCorrida;
+
+            // Registrar parada
+            Coordenada parada;
+            if (evento.tipo == COLETA) {
+                parada = demandas[evento.idDemanda].getOrigem();
+            } else {
+                parada = demandas[evento.idDemanda].getDestino();
+            }
+
+            paradas[inicioParadas[idCorrida] + paradasPorCorrida[idCorrida]] = parada;
+            paradasPorCorrida[idCorrida]++;
+
+            // Atualizar tempo de conclusão
+            tempoConclusao[idCorrida] = evento.tempo;
+
+            // Verificar se é o último evento da corrida (última entrega)
+            if (evento.tipo == ENTREGA && 
+                evento.indiceTrecho == corridas[idCorrida].numDemandas - 1) {
+                corridaConcluida[idCorrida] = true;
+            }
+        }
+    }
+
+    // Imprimir resultados (ordem de conclusão das corridas)
+    saida << fixed << setprecision(2);
+
+    for (int i = 0; i < numCorridas; i++) {
+        if (corridaConcluida[i]) {
+            saida << tempoConclusao[i] << " "
+                  << corridas[i].distanciaTotal << " "
+                  << paradasPorCorrida[i];
+
+            const Coordenada* paradasCorrida = paradas + inicioParadas[i];
+            for (int j = 0; j < paradasPorCorrida[i]; j++) {
+                saida << " " << paradasCorrida[j].x 
+                      << " " << paradasCorrida[j].y;
+            }
+            saida << endl;
+        }
+    }
+
+    resultado.numDemandas = numDemandas;
+    resultado.numCorridas = numCorridas;
+    resultado.candidatosEficiencia = candidatosEficiencia;
+    resultado.avaliacoesEvitadas = avaliacoesEvitadas;
+    resultado.numVeiculos = (frota != nullptr) ? numVeiculos : 0;
+    resultado.corridasComEspera = corridasComEspera;
+    resultado.distAproximacao = distAproximacao;
+    resultado.tempoEspera = tempoEspera;
+    resultado.latenciaDespacho = latenciaDespacho;
+    resultado.latenciaMaxima = latenciaMaxima;
+
+    if (frota != nullptr) {
+        delete frota;
+    }
+
+    return true;
+}
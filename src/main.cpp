@@ -1,306 +1,196 @@
-#include "Demanda.hpp"
-#include "Escalonador.hpp"
-#include "Corrida.hpp"
+#include "Simulacao.hpp"
+#include "Memoria.hpp"
 #include <iostream>
 #include <iomanip>
-#include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
 
 using namespace std;
 
 /**
- * @brief Verifica se duas demandas podem ser combinadas
- * @param d1 Primeira demanda
- * @param d2 Segunda demanda
- * @param alfa Distância máxima entre origens
- * @param beta Distância máxima entre destinos
- * @return true se podem ser combinadas
+ * @brief Imprime em stderr os contadores de uma simulação
+ * @param resultado Contadores da simulação
  */
-bool podeCombinar(const Demanda& d1, const Demanda& d2, double alfa, double beta) {
-    double distOrigens = d1.distanciaOrigem(d2.getOrigem());
-    double distDestinos = d1.distanciaDestino(d2.getDestino());
-
-    return (distOrigens <= alfa) && (distDestinos <= beta);
+void imprimirEstatisticas(const ResultadoSimulacao& resultado) {
+    cerr << "Pre-filtro de eficiencia: " << resultado.avaliacoesEvitadas << " de "
+         << resultado.candidatosEficiencia << " avaliacoes completas evitadas" << endl;
+
+    if (resultado.numVeiculos > 0) {
+        int numCorridas = resultado.numCorridas;
+        cerr << "Frota: " << resultado.numVeiculos << " veiculos, "
+             << numCorridas << " corridas despachadas, "
+             << resultado.corridasComEspera << " sem veiculo livre" << endl;
+        cerr << "Frota: aproximacao total " << resultado.distAproximacao
+             << ", espera media "
+             << (numCorridas > 0 ? resultado.tempoEspera / numCorridas : 0.0) << endl;
+        cerr << "Frota: latencia de despacho media "
+             << (numCorridas > 0 ? resultado.latenciaDespacho * 1e6 / numCorridas : 0.0)
+             << " us, maxima " << resultado.latenciaMaxima * 1e6 << " us" << endl;
+    }
 }
 
 /**
- * @brief Verifica se nova demanda pode ser adicionada ao grupo
- * @param demandas Array de todas demandas
- * @param grupo Array de índices das demandas no grupo atual
- * @param tamGrupo Tamanho do grupo
- * @param novaDemanda Índice da demanda a ser testada
- * @param alfa Critério de distância entre origens
- * @param beta Critério de distância entre destinos
- * @return true se pode adicionar
+ * @brief Item do manifesto do modo em lote
  */
-bool podeAdicionarAoGrupo(Demanda* demandas, int* grupo, int tamGrupo, 
-                          int novaDemanda, double alfa, double beta) {
-    // Verifica se a nova demanda satisfaz critérios com TODAS do grupo
-    for (int i = 0; i < tamGrupo; i++) {
-        if (!podeCombinar(demandas[grupo[i]], demandas[novaDemanda], alfa, beta)) {
-            return false;
-        }
-    }
-    return true;
-}
+struct ItemLote {
+    string entrada;               // Arquivo de entrada
+    string saida;                 // Arquivo de saída
+    bool sucesso;                 // Se a simulação terminou
+    double segundos;              // Tempo de leitura, simulação e escrita
+    ResultadoSimulacao resultado; // Contadores da simulação
+};
 
 /**
- * @brief Calcula eficiência de uma corrida compartilhada
- * @param demandas Array de demandas
- * @param grupo Índices das demandas na corrida
- * @param tamGrupo Número de demandas
- * @return Eficiência em porcentagem
+ * @brief Processa os pares entrada/saída de um manifesto em várias threads
+ *
+ * Cada linha do manifesto contém "entrada saida"; linhas vazias ou
+ * iniciadas por '#' são ignoradas. Cada thread mantém seu próprio
+ * ContextoSimulacao e retira o próximo item de um contador atômico.
+ *
+ * @param manifesto Caminho do manifesto
+ * @param numThreads Número de threads de trabalho
+ * @param numVeiculos Tamanho da frota (0: um veículo surge em cada coleta)
+ * @param rastrear Se true, inclui nas saídas o rastro de eficiência
+ * @return Código de saída do processo
  */
-double calcularEficienciaGrupo(Demanda* demandas, int* grupo, int tamGrupo) {
-    if (tamGrupo <= 1) return 1;
-
-    // Distância do trecho principal (soma das demandas avulsas)
-    double distPrincipal = 0;
-    for (int i=0; i < tamGrupo; i++){
-        distPrincipal += demandas[grupo[i]].calcularDistanciaViagem();
-    }
-    // Calcular distância total da rota: origem[0] -> origens[1..n] -> destinos[0..n]
-    double distTotal = 0.0;
-    Coordenada posAtual = demandas[grupo[0]].getOrigem();
-
-    // Fase de coletas: visitar origens das demais demandas
-    for (int i = 1; i < tamGrupo; i++) {
-        Coordenada proxOrigem = demandas[grupo[i]].getOrigem();
-        distTotal += calcularDistancia(posAtual, proxOrigem);
-        posAtual = proxOrigem;
+int executarLote(const char* manifesto, int numThreads, int numVeiculos, bool rastrear) {
+    ifstream arquivoManifesto(manifesto);
+    if (!arquivoManifesto) {
+        cerr << "Nao foi possivel abrir o manifesto: " << manifesto << endl;
+        return 1;
     }
 
-    // Fase de entregas: visitar todos os destinos
-    for (int i = 0; i < tamGrupo; i++) {
-        Coordenada destino = demandas[grupo[i]].getDestino();
-        distTotal += calcularDistancia(posAtual, destino);
-        posAtual = destino;
+    vector<ItemLote> itens;
+    string linha;
+    while (getline(arquivoManifesto, linha)) {
+        istringstream campos(linha);
+        ItemLote item;
+        if (!(campos >> item.entrada) || item.entrada[0] == '#') {
+            continue;
+        }
+        if (!(campos >> item.saida)) {
+            cerr << "Linha do manifesto sem arquivo de saida: " << linha << endl;
+            return 1;
+        }
+        item.sucesso = false;
+        item.segundos = 0.0;
+        itens.push_back(item);
     }
 
-    if (distTotal == 0.0) return 0.0;
-
-    return (distPrincipal / distTotal);
-}
-
-int main() {
-    // Leitura dos parâmetros
-    int eta;           // Capacidade dos veículos
-    double gama;       // Velocidade dos veículos
-    double delta;      // Intervalo temporal máximo
-    double alfa;       // Distância máxima entre origens
-    double beta;       // Distância máxima entre destinos
-    double lambda;     // Eficiência mínima
+    int numItens = (int)itens.size();
+    if (numThreads > numItens) numThreads = (numItens > 0) ? numItens : 1;
 
-    cin >> eta >> gama >> delta >> alfa >> beta >> lambda;
+    atomic<int> proximoItem(0);
+    chrono::steady_clock::time_point inicioLote = chrono::steady_clock::now();
 
-    // Leitura das demandas
-    int numDemandas;
-    cin >> numDemandas;
+    vector<thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.push_back(thread([&]() {
+            ContextoSimulacao ctx;
 
-    Demanda* demandas = new Demanda[numDemandas];
+            for (int k = proximoItem++; k < numItens; k = proximoItem++) {
+                ItemLote& item = itens[k];
+                chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
 
-    for (int i = 0; i < numDemandas; i++) {
-        int id;
-        double tempo;
-        Coordenada origem, destino;
+                ifstream entrada(item.entrada.c_str());
+                if (entrada) {
+                    ofstream saida(item.saida.c_str());
+                    if (saida) {
+                        item.sucesso = simular(entrada, saida, ctx, numVeiculos, rastrear,
+                                               item.resultado);
+                    }
+                }
 
-        cin >> id >> tempo >> origem.x >> origem.y >> destino.x >> destino.y;
-        demandas[i] = Demanda(id, tempo, origem, destino);
+                item.segundos = chrono::duration<double>(
+                    chrono::steady_clock::now() - inicio).count();
+            }
+        }));
     }
-
-    // Array para controlar quais demandas já foram atribuídas a corridas
-    bool* demandaAtribuida = new bool[numDemandas];
-    for (int i = 0; i < numDemandas; i++) {
-        demandaAtribuida[i] = false;
+    for (int t = 0; t < numThreads; t++) {
+        threads[t].join();
     }
 
-    // Array para armazenar corridas criadas
-    InfoCorrida* corridas = new InfoCorrida[numDemandas]; // No máximo numDemandas corridas
-    int numCorridas = 0;
-
-    // Escalonador para eventos
-    Escalonador escalonador;
+    double segundosLote = chrono::duration<double>(
+        chrono::steady_clock::now() - inicioLote).count();
 
-    // ========== FASE 1: COMBINAÇÃO DE CORRIDAS ==========
-
-    for (int i = 0; i < numDemandas; i++) {
-        // Pular se demanda já foi atribuída a alguma corrida
-        if (demandaAtribuida[i]) {
+    // Resumo por arquivo, na ordem do manifesto
+    int numFalhas = 0;
+    long long totalDemandas = 0;
+    cout << fixed << setprecision(2);
+    for (int k = 0; k < numItens; k++) {
+        const ItemLote& item = itens[k];
+        if (!item.sucesso) {
+            cerr << item.entrada << ": falha ao ler ou escrever" << endl;
+            numFalhas++;
             continue;
         }
+        totalDemandas += item.resultado.numDemandas;
+        cout << item.entrada << " -> " << item.saida << ": "
+             << item.resultado.numDemandas << " demandas, "
+             << item.resultado.numCorridas << " corridas, "
+             << item.segundos * 1e3 << " ms" << endl;
+    }
 
-        // Criar novo grupo de corrida começando com demanda i
-        int* grupo = new int[eta];  // Máximo eta passageiros
-        grupo[0] = i;
-        int tamGrupo = 1;
-        demandaAtribuida[i] = true;
-
-        double tempoBase = demandas[i].getTempoSolicitacao();
-
-        // Tentar adicionar outras demandas ao grupo
-        for (int j = i + 1; j < numDemandas; j++) {
-            // Pular se demanda já foi atribuída
-            if (demandaAtribuida[j]) {
-                continue;
-            }
-
-            // Verificar se grupo já está cheio
-            if (tamGrupo >= eta) {
-                break;
-            }
-
-            // Verificar intervalo temporal (critério delta)
-            double diffTempo = demandas[j].getTempoSolicitacao() - tempoBase;
-            if (diffTempo >= delta) {
-                break;  // Demandas estão ordenadas por tempo, pode parar
-            }
-
-            // Verificar se pode combinar com todas do grupo (critérios alfa e beta)
-            if (!podeAdicionarAoGrupo(demandas, grupo, tamGrupo, j, alfa, beta)) {
-                continue;  // Não pode combinar, tenta próxima
-            }
-
-            // Adicionar temporariamente ao grupo
-            grupo[tamGrupo] = j;
-            tamGrupo++;
+    cout << "Lote: " << (numItens - numFalhas) << " de " << numItens << " arquivos, "
+         << totalDemandas << " demandas em " << segundosLote << " s com "
+         << numThreads << " threads (" << (numItens - numFalhas) / segundosLote
+         << " arquivos/s, " << totalDemandas / segundosLote << " demandas/s)" << endl;
 
-            // Verificar eficiência
-            double eficiencia = calcularEficienciaGrupo(demandas, grupo, tamGrupo);
-            cout << "Representantes: " << i  << ", " << j << " | Eficiência: " << eficiencia << endl;
+    return (numFalhas > 0) ? 1 : 0;
+}
 
-            if (eficiencia <= lambda) {
-                // Eficiência insuficiente, remover última demanda
-                tamGrupo--;
-                // Não interrompe busca - tenta próximas demandas
-            } else {
-                // Aceita a demanda no grupo
-                demandaAtribuida[j] = true;
+int main(int argc, char* argv[]) {
+    instalarRelatorioMemoria();
+
+    // Opções de linha de comando
+    int numVeiculos = 0;          // Tamanho da frota (0: um veículo surge em cada coleta)
+    const char* manifesto = nullptr;
+    bool rastrear = false;        // Rastro "Representantes" de cada candidato avaliado
+    int numThreads = (int)thread::hardware_concurrency();
+    if (numThreads <= 0) numThreads = 1;
+
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "-v") == 0 && a + 1 < argc) {
+            numVeiculos = atoi(argv[++a]);
+            if (numVeiculos <= 0) {
+                cerr << "Numero de veiculos invalido: " << argv[a] << endl;
+                return 1;
             }
-        }
-
-        // Criar corrida com o grupo formado
-        InfoCorrida& corrida = corridas[numCorridas];
-        for (int k = 0; k < tamGrupo; k++) {
-            corrida.adicionarDemanda(grupo[k]);
-
-            // Atualizar estado da demanda
-            if (tamGrupo == 1) {
-                demandas[grupo[k]].setEstado(INDIVIDUAL);
-            } else {
-                demandas[grupo[k]].setEstado(COMBINADA);
+        } else if (strcmp(argv[a], "-d") == 0) {
+            rastrear = true;
+        } else if (strcmp(argv[a], "-l") == 0 && a + 1 < argc) {
+            manifesto = argv[++a];
+        } else if (strcmp(argv[a], "-t") == 0 && a + 1 < argc) {
+            numThreads = atoi(argv[++a]);
+            if (numThreads <= 0) {
+                cerr << "Numero de threads invalido: " << argv[a] << endl;
+                return 1;
             }
-        }
-
-        corrida.calcularRota(demandas, gama);
-
-        // Escalonar eventos de coleta e entrega
-        double tempoAtual = corrida.tempoInicio;
-        Coordenada posAtual = demandas[corrida.demandasIds[0]].getOrigem();
-
-        // Eventos de coleta
-        for (int k = 0; k < corrida.numDemandas; k++) {
-            Coordenada destColeta = demandas[corrida.demandasIds[k]].getOrigem();
-            double distancia = calcularDistancia(posAtual, destColeta);
-            tempoAtual += distancia / gama;
-
-            Evento eventoColeta = {tempoAtual, COLETA, numCorridas, 
-                                   corrida.demandasIds[k], k};
-            escalonador.insereEvento(eventoColeta);
-
-            posAtual = destColeta;
-        }
-
-        // Eventos de entrega
-        for (int k = 0; k < corrida.numDemandas; k++) {
-            Coordenada destEntrega = demandas[corrida.demandasIds[k]].getDestino();
-            double distancia = calcularDistancia(posAtual, destEntrega);
-            tempoAtual += distancia / gama;
-
-            Evento eventoEntrega = {tempoAtual, ENTREGA, numCorridas, 
-                                    corrida.demandasIds[k], k};
-            escalonador.insereEvento(eventoEntrega);
-
-            posAtual = destEntrega;
-        }
-
-        numCorridas++;
-        delete[] grupo;
-    }
-
-    // ========== FASE 2: PROCESSAMENTO DE EVENTOS E SAÍDA ==========
-
-    // Array para controlar quando cada corrida foi concluída
-    double* tempoConclusao = new double[numCorridas];
-    int* paradasPorCorrida = new int[numCorridas];
-    bool* corridaConcluida = new bool[numCorridas];
-
-    for (int i = 0; i < numCorridas; i++) {
-        tempoConclusao[i] = 0.0;
-        paradasPorCorrida[i] = 0;
-        corridaConcluida[i] = false;
-    }
-
-    // Arrays para armazenar paradas de cada corrida
-    Coordenada** paradasCorridas = new Coordenada*[numCorridas];
-    for (int i = 0; i < numCorridas; i++) {
-        // Máximo de paradas: numDemandas coletas + numDemandas entregas
-        paradasCorridas[i] = new Coordenada[corridas[i].numDemandas * 2];
-    }
-
-    // Processar eventos
-    while (!escalonador.vazio()) {
-        Evento evento = escalonador.retiraProximoEvento();
-        int idCorrida = evento.idCorrida;
-
-        // Registrar parada
-        Coordenada parada;
-        if (evento.tipo == COLETA) {
-            parada = demandas[evento.idDemanda].getOrigem();
         } else {
-            parada = demandas[evento.idDemanda].getDestino();
-        }
-
-        paradasCorridas[idCorrida][paradasPorCorrida[idCorrida]] = parada;
-        paradasPorCorrida[idCorrida]++;
-
-        // Atualizar tempo de conclusão
-        tempoConclusao[idCorrida] = evento.tempo;
-
-        // Verificar se é o último evento da corrida (última entrega)
-        if (evento.tipo == ENTREGA && 
-            evento.indiceTrecho == corridas[idCorrida].numDemandas - 1) {
-            corridaConcluida[idCorrida] = true;
+            cerr << "Uso: " << argv[0] << " [-d] [-v numVeiculos] < entrada" << endl;
+            cerr << "     " << argv[0] << " [-d] [-v numVeiculos] -l manifesto [-t numThreads]" << endl;
+            return 1;
         }
     }
 
-    // Imprimir resultados (ordem de conclusão das corridas)
-    cout << fixed << setprecision(2);
-
-    for (int i = 0; i < numCorridas; i++) {
-        if (corridaConcluida[i]) {
-            cout << tempoConclusao[i] << " "
-                 << corridas[i].distanciaTotal << " "
-                 << paradasPorCorrida[i];
-
-            for (int j = 0; j < paradasPorCorrida[i]; j++) {
-                cout << " " << paradasCorridas[i][j].x 
-                     << " " << paradasCorridas[i][j].y;
-            }
-            cout << endl;
-        }
+    if (manifesto != nullptr) {
+        return executarLote(manifesto, numThreads, numVeiculos, rastrear);
     }
 
-    // Liberar memória
-    delete[] demandas;
-    delete[] demandaAtribuida;
-    delete[] corridas;
-    delete[] tempoConclusao;
-    delete[] paradasPorCorrida;
-    delete[] corridaConcluida;
-
-    for (int i = 0; i < numCorridas; i++) {
-        delete[] paradasCorridas[i];
+    ContextoSimulacao ctx;
+    ResultadoSimulacao resultado;
+    if (!simular(cin, cout, ctx, numVeiculos, rastrear, resultado)) {
+        cerr << "Entrada invalida" << endl;
+        return 1;
     }
-    delete[] paradasCorridas;
+    imprimirEstatisticas(resultado);
 
     return 0;
-}
\ No newline at end of file
+}